@@ -0,0 +1,89 @@
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench {
+
+void Suite::add(std::string name,
+                Function body,
+                Function setup,
+                std::size_t items) {
+    benchmarks_.push_back(
+        Benchmark{std::move(name), std::move(body), std::move(setup), items});
+}
+
+void Suite::run(std::ostream& os,
+                const std::string& filter,
+                double min_sample_ms,
+                std::size_t samples) const {
+    using Clock = std::chrono::steady_clock;
+    for (const Benchmark& b : benchmarks_) {
+        if (b.name.find(filter) == std::string::npos) {
+            continue;
+        }
+        // Warm up caches and lazily allocated storage.
+        b.setup();
+        b.body();
+
+        std::vector<double> ns_per_iteration;
+        std::size_t total_iterations{0};
+        for (std::size_t s{0}; s < samples; ++s) {
+            std::chrono::nanoseconds elapsed{0};
+            std::size_t iterations{0};
+            while (elapsed.count() < min_sample_ms * 1e6) {
+                b.setup();
+                const auto start = Clock::now();
+                b.body();
+                elapsed += Clock::now() - start;
+                ++iterations;
+            }
+            total_iterations += iterations;
+            ns_per_iteration.push_back(static_cast<double>(elapsed.count()) /
+                                       iterations);
+        }
+        std::sort(std::begin(ns_per_iteration), std::end(ns_per_iteration));
+        const double median{ns_per_iteration[ns_per_iteration.size() / 2]};
+        os << std::fixed << std::setprecision(1) << "{\"name\":\""
+           << b.name << "\""
+           << ",\"iterations\":" << total_iterations
+           << ",\"samples\":" << samples
+           << ",\"items_per_iteration\":" << b.items
+           << ",\"ns_per_iteration_median\":" << median
+           << ",\"ns_per_iteration_min\":" << ns_per_iteration.front()
+           << ",\"ns_per_iteration_max\":" << ns_per_iteration.back()
+           << ",\"ns_per_item\":" << median / b.items << "}" << std::endl;
+    }
+}
+
+std::string make_text(std::size_t size) {
+    const char* const multibyte[] = {"é", "ß", "→", "─", "漢", "字"};
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<int> letter{'a', 'z'};
+    std::uniform_int_distribution<int> word_length{1, 10};
+    std::uniform_int_distribution<int> percent{0, 99};
+    std::uniform_int_distribution<int> pick{0, 5};
+    std::string text;
+    text.reserve(size + 16);
+    while (text.size() < size) {
+        const int length{word_length(gen)};
+        for (int i{0}; i < length; ++i) {
+            if (percent(gen) < 3) {
+                text.append(multibyte[pick(gen)]);
+            } else {
+                text.push_back(static_cast<char>(letter(gen)));
+            }
+        }
+        text.push_back(percent(gen) < 2 ? '\n' : ' ');
+    }
+    return text;
+}
+
+}  // namespace bench
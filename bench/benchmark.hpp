@@ -0,0 +1,56 @@
+#ifndef CPPURSES_BENCH_BENCHMARK_HPP
+#define CPPURSES_BENCH_BENCHMARK_HPP
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// Collection of named benchmarks. Each result is written as a single line
+// JSON object, so runs can be appended to a file and compared over time.
+class Suite {
+   public:
+    using Function = std::function<void()>;
+
+    // setup is run before every iteration and is not timed. items is the
+    // number of operations one call to body performs.
+    void add(std::string name,
+             Function body,
+             Function setup = [] {},
+             std::size_t items = 1);
+
+    // Runs every benchmark whose name contains filter.
+    void run(std::ostream& os,
+             const std::string& filter = "",
+             double min_sample_ms = 100.0,
+             std::size_t samples = 5) const;
+
+   private:
+    struct Benchmark {
+        std::string name;
+        Function body;
+        Function setup;
+        std::size_t items;
+    };
+    std::vector<Benchmark> benchmarks_;
+};
+
+// Delivers every Event posted to the System so far.
+void process_events();
+
+// Deterministic pseudo-random text of about size bytes, mostly ASCII words
+// with some multi-byte UTF-8 code points and a newline every few lines.
+std::string make_text(std::size_t size);
+
+void add_layout_benchmarks(Suite& suite);
+void add_paint_buffer_benchmarks(Suite& suite);
+void add_event_queue_benchmarks(Suite& suite);
+void add_text_display_benchmarks(Suite& suite);
+void add_glyph_string_benchmarks(Suite& suite);
+void add_timer_wheel_benchmarks(Suite& suite);
+void add_hit_test_benchmarks(Suite& suite);
+
+}  // namespace bench
+#endif  // CPPURSES_BENCH_BENCHMARK_HPP
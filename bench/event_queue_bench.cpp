@@ -0,0 +1,78 @@
+#include "benchmark.hpp"
+
+#include <cppurses/system/detail/event_invoker.hpp>
+#include <cppurses/system/detail/event_queue.hpp>
+#include <cppurses/system/events/key_event.hpp>
+#include <cppurses/system/events/paint_event.hpp>
+#include <cppurses/system/key.hpp>
+#include <cppurses/widget/widget.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace {
+using namespace cppurses;
+
+const std::size_t receiver_count{1000};
+const std::size_t rounds{10};
+
+struct Fixture {
+    Fixture() : receivers(receiver_count) {}
+    std::vector<Widget> receivers;
+    std::unique_ptr<detail::Event_queue> queue;
+};
+
+}  // namespace
+
+namespace bench {
+
+void add_event_queue_benchmarks(Suite& suite) {
+    auto fixture = std::make_shared<Fixture>();
+    auto reset = [fixture] {
+        fixture->queue = std::make_unique<detail::Event_queue>();
+    };
+
+    // Paint_events are coalesced per receiver, only receiver_count remain.
+    suite.add("event_queue/append_paint_coalesced",
+              [fixture] {
+                  for (std::size_t r{0}; r < rounds; ++r) {
+                      for (Widget& w : fixture->receivers) {
+                          fixture->queue->append(
+                              std::make_unique<Paint_event>(&w));
+                      }
+                  }
+              },
+              reset, receiver_count * rounds);
+
+    // Key_press_events are never coalesced.
+    suite.add("event_queue/append_key_press",
+              [fixture] {
+                  for (std::size_t r{0}; r < rounds; ++r) {
+                      for (Widget& w : fixture->receivers) {
+                          fixture->queue->append(
+                              std::make_unique<Key_press_event>(&w, Key::a));
+                      }
+                  }
+              },
+              reset, receiver_count * rounds);
+
+    // Key_press_events delivered to Widgets that ignore them.
+    suite.add("event_invoker/dispatch_key_press",
+              [fixture] {
+                  detail::Event_invoker invoker;
+                  invoker.invoke(*fixture->queue);
+              },
+              [fixture, reset] {
+                  reset();
+                  for (std::size_t r{0}; r < rounds; ++r) {
+                      for (Widget& w : fixture->receivers) {
+                          fixture->queue->append(
+                              std::make_unique<Key_press_event>(&w, Key::a));
+                      }
+                  }
+              },
+              receiver_count * rounds);
+}
+
+}  // namespace bench
@@ -0,0 +1,21 @@
+#include "benchmark.hpp"
+
+#include <cppurses/painter/glyph_string.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace bench {
+
+void add_glyph_string_benchmarks(Suite& suite) {
+    for (std::size_t size : {std::size_t{64}, std::size_t{1} << 20}) {
+        auto text = std::make_shared<std::string>(make_text(size));
+        const std::size_t code_points{cppurses::Glyph_string{*text}.size()};
+        suite.add("glyph_string/from_utf8_" + std::to_string(size),
+                  [text] { cppurses::Glyph_string gs{*text}; },
+                  [] {}, code_points);
+    }
+}
+
+}  // namespace bench
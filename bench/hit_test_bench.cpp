@@ -0,0 +1,58 @@
+#include "benchmark.hpp"
+
+#include <cppurses/system/detail/find_widget_at.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/layouts/horizontal_layout.hpp>
+#include <cppurses/widget/layouts/vertical_layout.hpp>
+#include <cppurses/widget/widget.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace {
+using namespace cppurses;
+
+const std::size_t rows{40};
+const std::size_t columns{50};
+const std::size_t screen_width{200};
+const std::size_t screen_height{60};
+
+}  // namespace
+
+namespace bench {
+
+// 2000 leaf Widgets in rows of Horizontal_layouts, on a 200x60 screen.
+void add_hit_test_benchmarks(Suite& suite) {
+    auto grid = std::make_shared<Vertical_layout>();
+    for (std::size_t r{0}; r < rows; ++r) {
+        auto& row = grid->make_child<Horizontal_layout>();
+        for (std::size_t c{0}; c < columns; ++c) {
+            row.make_child<Widget>();
+        }
+    }
+    auto make_head = [grid] {
+        if (System::head() != grid.get()) {
+            System::set_head(grid.get());
+            process_events();
+        }
+    };
+
+    suite.add("hit_test/every_cell_2000_widgets",
+              [] {
+                  for (std::size_t y{0}; y < screen_height; ++y) {
+                      for (std::size_t x{0}; x < screen_width; ++x) {
+                          detail::find_widget_at(x, y);
+                      }
+                  }
+              },
+              make_head, screen_width * screen_height);
+
+    suite.add("hit_test/rebuild_2000_widgets",
+              [] { detail::find_widget_at(0, 0); },
+              [make_head] {
+                  make_head();
+                  detail::invalidate_hit_grid();
+              });
+}
+
+}  // namespace bench
@@ -0,0 +1,108 @@
+#include "benchmark.hpp"
+
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/painter/painter.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/layout.hpp>
+#include <cppurses/widget/layouts/horizontal_layout.hpp>
+#include <cppurses/widget/layouts/vertical_layout.hpp>
+#include <cppurses/widget/widget.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+using namespace cppurses;
+
+// Layout::update_geometry() is protected, but a pointer to it can be formed
+// through a derived class.
+struct Geometry_access : Layout {
+    static void update(Layout& layout) {
+        auto update_geometry = &Geometry_access::update_geometry;
+        (layout.*update_geometry)();
+    }
+};
+
+void resize(Widget& w, std::size_t width, std::size_t height) {
+    System::send_event(Resize_event{&w, Area{width, height}});
+    bench::process_events();
+}
+
+template <typename Layout_t>
+void add_wide(bench::Suite& suite, const std::string& name, std::size_t n) {
+    auto root = std::make_shared<Layout_t>();
+    for (std::size_t i{0}; i < n; ++i) {
+        root->template make_child<Widget>();
+    }
+    resize(*root, 200, 60);
+    suite.add(name, [root] { Geometry_access::update(*root); },
+              [] { bench::process_events(); });
+}
+
+// Alternating Vertical_layout and Horizontal_layout, each with one nested
+// Layout and one leaf Widget. Every Layout in the tree is updated, top down.
+void add_deep(bench::Suite& suite, const std::string& name, std::size_t depth) {
+    auto root = std::make_shared<Vertical_layout>();
+    auto layouts = std::make_shared<std::vector<Layout*>>();
+    layouts->push_back(root.get());
+    Layout* current{root.get()};
+    for (std::size_t i{1}; i < depth; ++i) {
+        current->make_child<Widget>();
+        if (i % 2 == 0) {
+            current = &current->make_child<Vertical_layout>();
+        } else {
+            current = &current->make_child<Horizontal_layout>();
+        }
+        layouts->push_back(current);
+    }
+    current->make_child<Widget>();
+    resize(*root, 200, 60);
+    suite.add(name,
+              [root, layouts] {
+                  for (Layout* l : *layouts) {
+                      Geometry_access::update(*l);
+                  }
+              },
+              [] { bench::process_events(); }, depth);
+}
+
+// Painter::put() on the innermost leaf of a deep tree of bordered Layouts,
+// each glyph asks the leaf for its global position.
+void add_put_deep(bench::Suite& suite,
+                  const std::string& name,
+                  std::size_t depth) {
+    const std::size_t length{100};
+    auto root = std::make_shared<Vertical_layout>();
+    Layout* current{root.get()};
+    for (std::size_t i{1}; i < depth; ++i) {
+        enable_border(*current);
+        current = &current->make_child<Vertical_layout>();
+    }
+    Widget* leaf{&current->make_child<Widget>()};
+    auto text = std::make_shared<Glyph_string>(std::string(length, 'x'));
+    suite.add(name, [leaf, text] { Painter{leaf}.put(*text, 0, 0); },
+              [root] {
+                  if (System::head() != root.get()) {
+                      System::set_head(root.get());
+                      bench::process_events();
+                  }
+              },
+              length);
+}
+
+}  // namespace
+
+namespace bench {
+
+void add_layout_benchmarks(Suite& suite) {
+    add_wide<Vertical_layout>(suite, "layout/vertical_wide_1000", 1000);
+    add_wide<Horizontal_layout>(suite, "layout/horizontal_wide_1000", 1000);
+    add_deep(suite, "layout/deep_64", 64);
+    add_put_deep(suite, "layout/put_deep_24", 24);
+}
+
+}  // namespace bench
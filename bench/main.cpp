@@ -0,0 +1,47 @@
+#include "benchmark.hpp"
+
+#include <cppurses/painter/detail/headless_paint_engine.hpp>
+#include <cppurses/system/detail/headless_event_listener.hpp>
+#include <cppurses/system/system.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace {
+cppurses::System* the_system{nullptr};
+}  // namespace
+
+namespace bench {
+
+// The headless listener has an empty script, so run() returns as soon as the
+// queued Events have been delivered.
+void process_events() {
+    the_system->run();
+}
+
+}  // namespace bench
+
+// Usage: cppurses_bench [filter] [min_sample_ms]
+// Prints one JSON object per benchmark whose name contains filter.
+int main(int argc, char* argv[]) {
+    using namespace cppurses;
+    System sys{std::make_unique<detail::Headless_paint_engine>(200, 60),
+               std::make_unique<detail::Headless_event_listener>()};
+    the_system = &sys;
+
+    const std::string filter{argc > 1 ? argv[1] : ""};
+    const double min_sample_ms{argc > 2 ? std::atof(argv[2]) : 100.0};
+
+    bench::Suite suite;
+    bench::add_layout_benchmarks(suite);
+    bench::add_paint_buffer_benchmarks(suite);
+    bench::add_event_queue_benchmarks(suite);
+    bench::add_text_display_benchmarks(suite);
+    bench::add_glyph_string_benchmarks(suite);
+    bench::add_timer_wheel_benchmarks(suite);
+    bench::add_hit_test_benchmarks(suite);
+    suite.run(std::cout, filter, min_sample_ms);
+    return 0;
+}
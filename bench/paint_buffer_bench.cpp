@@ -0,0 +1,98 @@
+#include "benchmark.hpp"
+
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/color.hpp>
+#include <cppurses/painter/detail/headless_paint_engine.hpp>
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/paint_buffer.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <random>
+
+namespace {
+using namespace cppurses;
+
+const std::size_t width{200};
+const std::size_t height{60};
+
+std::shared_ptr<Paint_buffer> make_buffer() {
+    auto buffer = std::make_shared<Paint_buffer>(
+        std::make_unique<detail::Headless_paint_engine>(width, height));
+    buffer->flush(false);
+    return buffer;
+}
+
+}  // namespace
+
+namespace bench {
+
+void add_paint_buffer_benchmarks(Suite& suite) {
+    // Every cell changes, alternating between two Glyphs and Brushes.
+    {
+        auto buffer = make_buffer();
+        auto flip = std::make_shared<bool>(false);
+        suite.add("paint_buffer/flush_full", [buffer] { buffer->flush(true); },
+                  [buffer, flip] {
+                      *flip = !*flip;
+                      const Glyph g{*flip ? "a" : "b",
+                                    foreground(*flip ? Color::White
+                                                     : Color::Red),
+                                    background(Color::Blue)};
+                      for (std::size_t y{0}; y < height; ++y) {
+                          for (std::size_t x{0}; x < width; ++x) {
+                              buffer->stage(x, y, g);
+                          }
+                      }
+                  },
+                  width * height);
+    }
+    // One percent of the cells change, at random positions.
+    {
+        auto buffer = make_buffer();
+        auto gen = std::make_shared<std::mt19937>(42);
+        auto flip = std::make_shared<bool>(false);
+        const std::size_t changes{width * height / 100};
+        suite.add("paint_buffer/flush_sparse",
+                  [buffer] { buffer->flush(true); },
+                  [buffer, gen, flip, changes] {
+                      *flip = !*flip;
+                      const Glyph g{*flip ? "x" : "y"};
+                      std::uniform_int_distribution<std::size_t> x{0,
+                                                                   width - 1};
+                      std::uniform_int_distribution<std::size_t> y{0,
+                                                                   height - 1};
+                      for (std::size_t i{0}; i < changes; ++i) {
+                          buffer->stage(x(*gen), y(*gen), g);
+                      }
+                  },
+                  changes);
+    }
+    // Nothing staged since the last flush.
+    {
+        auto buffer = make_buffer();
+        suite.add("paint_buffer/flush_unchanged",
+                  [buffer] { buffer->flush(true); });
+    }
+    // Every cell of a 500x150 screen restaged with what it already holds, as
+    // when Widgets repaint unchanged contents.
+    {
+        const std::size_t big_width{500};
+        const std::size_t big_height{150};
+        auto buffer = std::make_shared<Paint_buffer>(
+            std::make_unique<detail::Headless_paint_engine>(big_width,
+                                                            big_height));
+        buffer->flush(false);
+        suite.add("paint_buffer/flush_restaged_500x150",
+                  [buffer] { buffer->flush(true); },
+                  [buffer, big_width, big_height] {
+                      for (std::size_t y{0}; y < big_height; ++y) {
+                          std::size_t length{big_width};
+                          buffer->stage_span(0, y, length);
+                      }
+                  },
+                  big_width * big_height);
+    }
+}
+
+}  // namespace bench
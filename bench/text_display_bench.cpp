@@ -0,0 +1,101 @@
+#include "benchmark.hpp"
+
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/painter/paint_buffer.hpp>
+#include <cppurses/system/events/paint_event.hpp>
+#include <cppurses/system/events/paste_event.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/widgets/text_display.hpp>
+#include <cppurses/widget/widgets/textbox.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace {
+using namespace cppurses;
+
+struct Bench_text_display : Text_display {
+    using Text_display::Text_display;
+    using Text_display::line_at;
+    using Text_display::update_display;
+};
+
+const std::size_t text_size{1 << 20};
+
+}  // namespace
+
+namespace bench {
+
+void add_text_display_benchmarks(Suite& suite) {
+    auto text = std::make_shared<Glyph_string>(make_text(text_size));
+    for (bool wrap : {true, false}) {
+        auto display = std::make_shared<Bench_text_display>();
+        System::send_event(Resize_event{display.get(), Area{80, 24}});
+        display->enable_word_wrap(wrap);
+        display->set_text(*text);
+        process_events();
+        suite.add(wrap ? "text_display/update_display_1mb_wrap"
+                       : "text_display/update_display_1mb_nowrap",
+                  [display] { display->update_display(); },
+                  [] {}, text->size());
+    }
+
+    // One character typed and removed again, each rewraps the edited lines.
+    auto display = std::make_shared<Bench_text_display>();
+    System::send_event(Resize_event{display.get(), Area{80, 24}});
+    display->set_text(*text);
+    process_events();
+    suite.add("text_display/type_end_1mb",
+              [display] {
+                  display->append("x");
+                  display->pop_back();
+              });
+    suite.add("text_display/type_middle_1mb",
+              [display, text] {
+                  display->insert("x", text->size() / 2);
+                  display->erase(text->size() / 2, 1);
+              });
+    suite.add("text_display/line_at_1mb",
+              [display, text] {
+                  for (std::size_t i{0}; i < text->size(); i += 1000) {
+                      display->line_at(i);
+                  }
+              },
+              [] {}, text->size() / 1000);
+
+    // Full screen view scrolled by one line, painted and flushed. Items are
+    // screen rows.
+    auto view = std::make_shared<Bench_text_display>();
+    System::send_event(Resize_event{
+        view.get(), Area{System::max_width(), System::max_height()}});
+    view->set_text(*text);
+    auto down = std::make_shared<bool>(false);
+    suite.add("text_display/scroll_paint_full_screen",
+              [view] {
+                  System::send_event(Paint_event{view.get()});
+                  System::paint_buffer()->flush(true);
+              },
+              [view, down] {
+                  if (System::head() != view.get()) {
+                      System::set_head(view.get());
+                  }
+                  process_events();
+                  *down = !*down;
+                  *down ? view->scroll_down() : view->scroll_up();
+              },
+              System::max_height());
+
+    auto textbox = std::make_shared<Textbox>();
+    System::send_event(Resize_event{textbox.get(), Area{80, 24}});
+    auto pasted = std::make_shared<std::string>(text->str());
+    suite.add("textbox/paste_1mb",
+              [textbox, pasted] {
+                  System::send_event(Paste_event{textbox.get(), *pasted});
+              },
+              [textbox] { textbox->clear(); }, text->size());
+}
+
+}  // namespace bench
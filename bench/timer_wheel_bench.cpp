@@ -0,0 +1,65 @@
+#include "benchmark.hpp"
+
+#include <cppurses/system/detail/timer_wheel.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace {
+using cppurses::detail::Timer_wheel;
+
+const std::size_t timer_count{10000};
+
+struct Fixture {
+    std::unique_ptr<Timer_wheel> wheel;
+    std::vector<Timer_wheel::Id> ids;
+    std::vector<Timer_wheel::Expired> due;
+    Timer_wheel::Clock::time_point now;
+};
+
+}  // namespace
+
+namespace bench {
+
+void add_timer_wheel_benchmarks(Suite& suite) {
+    auto fixture = std::make_shared<Fixture>();
+    auto reset = [fixture] {
+        fixture->now = Timer_wheel::Clock::time_point{};
+        fixture->wheel = std::make_unique<Timer_wheel>(fixture->now);
+        fixture->ids.clear();
+        fixture->due.clear();
+    };
+
+    suite.add("timer_wheel/add_remove",
+              [fixture] {
+                  for (std::size_t i{0}; i < timer_count; ++i) {
+                      fixture->ids.push_back(fixture->wheel->add(
+                          nullptr, std::chrono::milliseconds{1 + i * 7}, true,
+                          fixture->now));
+                  }
+                  for (Timer_wheel::Id id : fixture->ids) {
+                      fixture->wheel->remove(id);
+                  }
+              },
+              reset, timer_count);
+
+    // Repeating timers with periods from 1ms to 10s, one second passes.
+    suite.add("timer_wheel/advance_1s",
+              [fixture] {
+                  fixture->wheel->advance(
+                      fixture->due, fixture->now + std::chrono::seconds{1});
+              },
+              [fixture, reset] {
+                  reset();
+                  for (std::size_t i{0}; i < timer_count; ++i) {
+                      fixture->wheel->add(nullptr,
+                                          std::chrono::milliseconds{1 + i},
+                                          true, fixture->now);
+                  }
+              },
+              timer_count);
+}
+
+}  // namespace bench
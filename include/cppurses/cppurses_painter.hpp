@@ -1,7 +1,10 @@
 #ifndef CPPURSES_PAINTER_HPP
 #define CPPURSES_PAINTER_HPP
 
+#include <cppurses/painter/detail/ansi_paint_engine.hpp>
+#include <cppurses/painter/detail/headless_paint_engine.hpp>
 #include <cppurses/painter/detail/ncurses_paint_engine.hpp>
+#include <cppurses/painter/detail/paint_engine.hpp>
 
 #include <cppurses/painter/attribute.hpp>
 #include <cppurses/painter/brush.hpp>
@@ -1,6 +1,8 @@
 #ifndef CPPURSES_SYSTEM_HPP
 #define CPPURSES_SYSTEM_HPP
 
+#include <cppurses/system/detail/headless_event_listener.hpp>
+
 #include <cppurses/system/events/child_event.hpp>
 #include <cppurses/system/events/clear_screen_event.hpp>
 #include <cppurses/system/events/close_event.hpp>
@@ -14,8 +16,10 @@
 #include <cppurses/system/events/mouse_event.hpp>
 #include <cppurses/system/events/move_event.hpp>
 #include <cppurses/system/events/paint_event.hpp>
+#include <cppurses/system/events/paste_event.hpp>
 #include <cppurses/system/events/resize_event.hpp>
 #include <cppurses/system/events/show_event.hpp>
+#include <cppurses/system/events/timer_event.hpp>
 
 #include <cppurses/system/event.hpp>
 #include <cppurses/system/event_handler.hpp>
@@ -36,6 +36,7 @@ class Brush {
     void set_foreground(Color color) { foreground_color_ = color; }
 
     std::vector<Attribute> attributes() const;
+    bool has_attribute(Attribute attr) const;
     const opt::Optional<Color>& background_color() const {
         return background_color_;
     }
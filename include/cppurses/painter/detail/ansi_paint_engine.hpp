@@ -0,0 +1,73 @@
+#ifndef PAINTER_DETAIL_ANSI_PAINT_ENGINE_HPP
+#define PAINTER_DETAIL_ANSI_PAINT_ENGINE_HPP
+#include <cppurses/painter/color.hpp>
+#include <cppurses/painter/detail/paint_engine.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace cppurses {
+class Brush;
+class Glyph;
+namespace detail {
+
+// Writes ANSI/VT escape sequences directly to the terminal, bypassing the
+// ncurses screen. A frame is collected in one buffer and written with a single
+// write(2) on refresh(). Cursor movement uses the shortest sequence available
+// and SGR sequences are only emitted when the Brush actually changes.
+// ncurses is still initialized for input, so this engine can be used with the
+// NCurses_event_listener.
+class ANSI_paint_engine : public Paint_engine {
+   public:
+    explicit ANSI_paint_engine(int output_fd = 1);
+    ~ANSI_paint_engine() override;
+
+    void set_rgb(Color c,
+                 std::int16_t r,
+                 std::int16_t g,
+                 std::int16_t b) override;
+
+    void put_glyph(const Glyph& g) override;
+    void put_run(std::size_t x,
+                 std::size_t y,
+                 const Glyph* first,
+                 std::size_t length) override;
+
+    void show_cursor(bool show = true) override;
+    std::size_t screen_width() override;
+    std::size_t screen_height() override;
+    void touch_all() override;
+    void move(std::size_t x, std::size_t y) override;
+    void refresh() override;
+
+   private:
+    void move_cursor();
+    void set_brush(const Brush& brush);
+    void append_number(std::size_t n);
+    void write_buffer();
+
+    int output_fd_;
+    std::string buffer_;
+    std::size_t width_{0};
+
+    // Cursor position requested by move().
+    std::size_t x_{0};
+    std::size_t y_{0};
+
+    // Cursor position on the terminal, if known.
+    bool cursor_known_{false};
+    std::size_t cursor_x_{0};
+    std::size_t cursor_y_{0};
+    bool cursor_visible_{true};
+
+    // SGR state on the terminal, if known.
+    bool sgr_known_{false};
+    std::uint8_t attributes_{0};
+    Color foreground_{Color::Black};
+    Color background_{Color::Black};
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // PAINTER_DETAIL_ANSI_PAINT_ENGINE_HPP
@@ -0,0 +1,150 @@
+#ifndef PAINTER_DETAIL_CELL_HPP
+#define PAINTER_DETAIL_CELL_HPP
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/detail/grapheme_table.hpp>
+#include <cppurses/painter/glyph.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace cppurses {
+namespace detail {
+
+// Glyph packed into eight bytes, as stored by the Paint_buffer. Glyph is the
+// type Cells are built from and turned back into for the Paint_engine.
+struct Cell {
+    // UTF-8 bytes of the symbol, the first byte in the lowest eight bits, or
+    // grapheme_id_marker followed by a Grapheme_table id, as Glyph stores it.
+    std::uint32_t symbol{0};
+    // Bit i is set if static_cast<Attribute>(i) is.
+    std::uint8_t attributes{0};
+    // Background in the low four bits, foreground in the high four bits,
+    // each as an offset from Color::Black.
+    std::uint8_t colors{0};
+    // has_background, has_foreground, wide and continuation bits.
+    std::uint8_t flags{0};
+    std::uint8_t unused{0};
+
+    static const std::uint8_t has_background{1};
+    static const std::uint8_t has_foreground{2};
+    // The symbol takes up this cell and the continuation cell after it.
+    static const std::uint8_t wide{4};
+    // Right half of the wide Cell before it, with no symbol of its own.
+    static const std::uint8_t continuation{8};
+};
+
+static_assert(sizeof(Cell) == 8, "Cell is compared as a single integer.");
+
+inline std::uint64_t bits(const Cell& c) {
+    std::uint64_t value;
+    std::memcpy(&value, &c, sizeof(value));
+    return value;
+}
+
+inline bool operator==(const Cell& lhs, const Cell& rhs) {
+    return bits(lhs) == bits(rhs);
+}
+
+inline bool operator!=(const Cell& lhs, const Cell& rhs) {
+    return bits(lhs) != bits(rhs);
+}
+
+// True if both Cells have the same attributes and colors.
+inline bool same_brush(const Cell& lhs, const Cell& rhs) {
+    const std::uint8_t color_flags{Cell::has_background |
+                                   Cell::has_foreground};
+    return lhs.attributes == rhs.attributes && lhs.colors == rhs.colors &&
+           (lhs.flags & color_flags) == (rhs.flags & color_flags);
+}
+
+inline bool is_wide(const Cell& c) {
+    return (c.flags & Cell::wide) != 0;
+}
+
+inline bool is_continuation(const Cell& c) {
+    return (c.flags & Cell::continuation) != 0;
+}
+
+// True if the Cell::symbol takes up two columns.
+bool wide_symbol(std::uint32_t symbol);
+
+// Sets the symbol of c, and whether it is wide.
+inline void set_symbol(Cell& c, std::uint32_t symbol) {
+    c.symbol = symbol;
+    c.flags &= ~(Cell::wide | Cell::continuation);
+    // Nothing below U+1100, the first wide code point, is wide.
+    if ((symbol & 0xFF) >= 0xE1 && wide_symbol(symbol)) {
+        c.flags |= Cell::wide;
+    }
+}
+
+// The continuation Cell that follows wide, with the same Brush.
+inline Cell continuation_of(const Cell& wide) {
+    Cell c{wide};
+    c.symbol = 0;
+    c.flags = (c.flags & ~Cell::wide) | Cell::continuation;
+    return c;
+}
+
+// Replaces the symbol of c with a space, keeping its Brush.
+inline void blank(Cell& c) {
+    c.symbol = ' ';
+    c.flags &= ~(Cell::wide | Cell::continuation);
+}
+
+Cell to_cell(const Glyph& g);
+Glyph to_glyph(const Cell& c);
+
+// Sets the symbol of g to that of c, leaving the Brush of g as it is.
+void set_symbol(Glyph& g, const Cell& c);
+
+// Replaces the attributes and colors of c with those of b, and leaves its
+// symbol as it is.
+void set_brush(Cell& c, const Brush& b);
+
+// Gives c the colors of defaults that c does not set itself, and adds the
+// attributes of defaults to those of c.
+inline void add_default_brush(Cell& c, const Cell& defaults) {
+    if ((c.flags & Cell::has_background) == 0) {
+        c.colors = (c.colors & 0xF0) | (defaults.colors & 0x0F);
+    }
+    if ((c.flags & Cell::has_foreground) == 0) {
+        c.colors = (c.colors & 0x0F) | (defaults.colors & 0xF0);
+    }
+    c.flags |= defaults.flags;
+    c.attributes |= defaults.attributes;
+}
+
+// Row-major, contiguous matrix of Cells, laid out like Glyph_matrix.
+class Cell_matrix {
+   public:
+    // Keeps the Cells that fit in the new dimensions, new cells are " ".
+    void resize(std::size_t width, std::size_t height);
+
+    std::size_t width() const { return width_; }
+    std::size_t height() const { return height_; }
+
+    Cell& operator()(std::size_t x, std::size_t y) {
+        return matrix_[y * width_ + x];
+    }
+    const Cell& operator()(std::size_t x, std::size_t y) const {
+        return matrix_[y * width_ + x];
+    }
+
+    // Pointer to the first Cell of row y, the row is width() Cells long.
+    Cell* row(std::size_t y) { return matrix_.data() + y * width_; }
+    const Cell* row(std::size_t y) const {
+        return matrix_.data() + y * width_;
+    }
+
+   private:
+    std::vector<Cell> matrix_;
+    std::size_t width_{0};
+    std::size_t height_{0};
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // PAINTER_DETAIL_CELL_HPP
@@ -0,0 +1,25 @@
+#ifndef PAINTER_DETAIL_CELL_DIFF_HPP
+#define PAINTER_DETAIL_CELL_DIFF_HPP
+#include <cppurses/painter/detail/cell.hpp>
+
+#include <cstddef>
+
+namespace cppurses {
+namespace detail {
+
+// Index of the first Cell in [0, length) where lhs and rhs differ, length if
+// they are equal. Compares 16 or 32 Cells at a time with SSE2 or AVX2 where
+// the CPU has it, chosen on first use.
+std::size_t find_mismatch(const Cell* lhs, const Cell* rhs, std::size_t length);
+
+// One Cell at a time, the fallback of find_mismatch.
+std::size_t find_mismatch_scalar(const Cell* lhs,
+                                 const Cell* rhs,
+                                 std::size_t length);
+
+// Name of the implementation find_mismatch uses: "avx2", "sse2" or "scalar".
+const char* find_mismatch_implementation();
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // PAINTER_DETAIL_CELL_DIFF_HPP
@@ -0,0 +1,20 @@
+#ifndef PAINTER_DETAIL_CHAR_WIDTH_HPP
+#define PAINTER_DETAIL_CHAR_WIDTH_HPP
+#include <cstddef>
+
+namespace cppurses {
+namespace detail {
+
+// Terminal columns taken up by a code point: 0 for combining and other zero
+// width code points, 2 for East Asian wide and fullwidth ones, 1 otherwise.
+// Control characters count as 1, the cell they are painted in. Looked up in
+// tables built at compile time, the locale is not consulted.
+int char_width(char32_t c);
+
+// Columns taken up by a UTF-8 symbol painted into a single cell, 1 or 2. Set
+// by its first code point, or by an emoji presentation selector after it.
+std::size_t symbol_width(const char* symbol, std::size_t length);
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // PAINTER_DETAIL_CHAR_WIDTH_HPP
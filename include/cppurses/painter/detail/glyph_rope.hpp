@@ -0,0 +1,160 @@
+#ifndef PAINTER_DETAIL_GLYPH_ROPE_HPP
+#define PAINTER_DETAIL_GLYPH_ROPE_HPP
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/detail/cell.hpp>
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cppurses {
+namespace detail {
+
+// Sequence of Glyphs stored as a persistent AVL tree of leaves. Each leaf
+// holds up to max_leaf_size symbols as UTF-8 bytes, with their Brushes kept
+// apart as runs of equal Brushes. Insert, erase and at() are O(log n), and
+// copies share all nodes, so a copy is an O(1) snapshot.
+class Glyph_rope {
+    struct Node;
+    using Node_ptr = std::shared_ptr<const Node>;
+
+   public:
+    class Iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Glyph;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Glyph*;
+        using reference = Glyph;
+
+        Iterator() = default;
+
+        Glyph operator*() const;
+
+        Iterator& operator++();
+        Iterator operator++(int);
+
+        // Symbol of the current Glyph compared to a single byte symbol,
+        // without building the Glyph.
+        bool symbol_is(char symbol) const;
+
+        // Terminal columns the Glyph takes up, 1 or 2.
+        std::size_t width() const;
+
+        std::size_t index() const { return index_; }
+
+        bool operator==(const Iterator& other) const {
+            return index_ == other.index_;
+        }
+        bool operator!=(const Iterator& other) const {
+            return index_ != other.index_;
+        }
+
+       private:
+        friend class Glyph_rope;
+        Iterator(const Node* root, std::size_t index);
+        void find_leaf();
+
+        const Node* root_{nullptr};
+        std::size_t index_{0};
+        const Node* leaf_{nullptr};
+        std::size_t leaf_end_{0};
+        std::size_t byte_{0};
+        std::size_t run_{0};
+        std::size_t run_left_{0};
+    };
+
+    using const_iterator = Iterator;
+
+    // Leaves are split past this many Glyphs.
+    static const std::size_t max_leaf_size{512};
+
+    Glyph_rope() = default;
+    explicit Glyph_rope(const Glyph_string& glyphs);
+
+    std::size_t size() const;
+    bool empty() const { return this->size() == 0; }
+
+    Glyph at(std::size_t index) const;
+    Iterator begin() const { return this->iterator_at(0); }
+    Iterator end() const { return this->iterator_at(this->size()); }
+    Iterator iterator_at(std::size_t index) const;
+
+    void insert(std::size_t index, const Glyph_string& glyphs);
+    void append(const Glyph_string& glyphs);
+    // Erases up to length Glyphs, stopping at the end of the rope.
+    void erase(std::size_t index, std::size_t length = Glyph_string::npos);
+    void clear() { root_.reset(); }
+
+    Glyph_string substr(std::size_t index,
+                        std::size_t length = Glyph_string::npos) const;
+    // Writes the length Glyphs from index on to out, which must have room,
+    // one Cell each. Returns how many of them are wide.
+    std::size_t copy(std::size_t index, std::size_t length, Cell* out) const;
+    Glyph_string str() const { return this->substr(0); }
+
+    // Number of nodes in the tree, both leaves and branches.
+    std::size_t node_count() const;
+    // Height of the tree, a single leaf has height zero.
+    std::size_t height() const;
+
+   private:
+    struct Run {
+        std::size_t length;
+        Brush brush;
+    };
+
+    // A branch has both children and no symbols, a leaf has no children.
+    struct Node {
+        Node_ptr left;
+        Node_ptr right;
+        std::size_t size{0};
+        std::size_t height{0};
+        std::string symbols;
+        std::vector<Run> runs;
+        // Every symbol is a single byte, so indexing needs no scan.
+        bool single_byte{true};
+    };
+
+    static std::size_t size(const Node_ptr& node);
+    static std::size_t height(const Node_ptr& node);
+    static Node_ptr make_branch(Node_ptr left, Node_ptr right);
+
+    // Adds the glyphs [first, last) of leaf to the leaf being built.
+    static void append_to_leaf(Node& leaf,
+                               const Node& from,
+                               std::size_t first,
+                               std::size_t last);
+    static void append_to_leaf(Node& leaf, const Glyph& glyph);
+    static std::size_t byte_offset(const Node& leaf, std::size_t index);
+
+    static Node_ptr build(const Glyph_string& glyphs,
+                          std::size_t first,
+                          std::size_t last);
+    static Node_ptr join(Node_ptr left, Node_ptr right);
+    static Node_ptr join_right(const Node_ptr& left, const Node_ptr& right);
+    static Node_ptr join_left(const Node_ptr& left, const Node_ptr& right);
+    static Node_ptr rotate_left(const Node_ptr& node);
+    static Node_ptr rotate_right(const Node_ptr& node);
+    static void split(const Node_ptr& node,
+                      std::size_t index,
+                      Node_ptr& left,
+                      Node_ptr& right);
+    // Replaces length glyphs at index within a single leaf.
+    static Node_ptr replace(const Node_ptr& node,
+                            std::size_t index,
+                            std::size_t length,
+                            const Glyph_string& glyphs);
+
+    static std::size_t node_count(const Node_ptr& node);
+
+    Node_ptr root_;
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // PAINTER_DETAIL_GLYPH_ROPE_HPP
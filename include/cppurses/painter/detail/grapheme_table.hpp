@@ -0,0 +1,55 @@
+#ifndef PAINTER_DETAIL_GRAPHEME_TABLE_HPP
+#define PAINTER_DETAIL_GRAPHEME_TABLE_HPP
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace cppurses {
+namespace detail {
+
+// A four byte symbol starting with this byte holds a Grapheme_table id in the
+// three bytes that follow, lowest byte first. 0xFF never starts UTF-8.
+const unsigned char grapheme_id_marker{0xFF};
+
+// Owns symbols too long to be stored inline by Glyph and Cell, such as
+// combining sequences and emoji ZWJ clusters. Each distinct symbol is stored
+// once under a small id, so symbols compare by id. Entries are never removed,
+// ids and symbol references stay valid for the life of the program.
+// Thread safe.
+class Grapheme_table {
+   public:
+    // Ids fit in the three bytes after grapheme_id_marker.
+    static const std::uint32_t max_size{1 << 24};
+
+    // Id of the symbol, adding it if it is not in the table yet. Throws
+    // std::length_error if the table already holds max_size symbols.
+    std::uint32_t intern(const char* symbol, std::size_t length);
+
+    // UTF-8 bytes of the symbol with the given id.
+    const std::string& symbol(std::uint32_t id) const;
+
+    // Terminal columns taken up by the symbol with the given id.
+    std::size_t width(std::uint32_t id) const;
+
+    std::size_t size() const;
+
+   private:
+    struct Entry {
+        std::string symbol;
+        std::size_t width;
+    };
+
+    mutable std::mutex mtx_;
+    std::deque<Entry> entries_;
+    std::unordered_map<std::string, std::uint32_t> ids_;
+};
+
+// The table used by every Glyph.
+Grapheme_table& grapheme_table();
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // PAINTER_DETAIL_GRAPHEME_TABLE_HPP
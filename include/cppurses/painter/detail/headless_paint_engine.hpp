@@ -0,0 +1,68 @@
+#ifndef PAINTER_DETAIL_HEADLESS_PAINT_ENGINE_HPP
+#define PAINTER_DETAIL_HEADLESS_PAINT_ENGINE_HPP
+#include <cppurses/painter/color.hpp>
+#include <cppurses/painter/detail/paint_engine.hpp>
+#include <cppurses/painter/glyph_matrix.hpp>
+#include <cppurses/widget/point.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cppurses {
+class Glyph;
+namespace detail {
+
+// Paints into an in-memory screen of a given size, no terminal is needed.
+// Used for tests, benchmarks and running applications without a TTY.
+class Headless_paint_engine : public Paint_engine {
+   public:
+    explicit Headless_paint_engine(std::size_t width = 80,
+                                   std::size_t height = 24);
+
+    void set_rgb(Color c,
+                 std::int16_t r,
+                 std::int16_t g,
+                 std::int16_t b) override;
+
+    void put_glyph(const Glyph& g) override;
+    void put_run(std::size_t x,
+                 std::size_t y,
+                 const Glyph* first,
+                 std::size_t length) override;
+
+    void show_cursor(bool show = true) override;
+    std::size_t screen_width() override;
+    std::size_t screen_height() override;
+    void touch_all() override;
+    void move(std::size_t x, std::size_t y) override;
+    void refresh() override;
+
+    // Contents of the virtual screen. The column covered by the right half of
+    // a wide Glyph holds an empty Glyph with the same Brush.
+    const Glyph_matrix& screen() const { return screen_; }
+
+    // Takes effect on the next screen_width()/screen_height() query, post a
+    // Resize_event to the head Widget to have the application notice.
+    void resize(std::size_t width, std::size_t height);
+
+    bool cursor_visible() const { return cursor_visible_; }
+    Point cursor_position() const { return cursor_; }
+
+    // Counters for benchmarks, reset with reset_counters().
+    std::size_t glyphs_written() const { return glyphs_written_; }
+    std::size_t refresh_count() const { return refresh_count_; }
+    void reset_counters();
+
+   private:
+    Glyph_matrix screen_;
+    std::size_t width_;
+    std::size_t height_;
+    Point cursor_;
+    bool cursor_visible_{true};
+    std::size_t glyphs_written_{0};
+    std::size_t refresh_count_{0};
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // PAINTER_DETAIL_HEADLESS_PAINT_ENGINE_HPP
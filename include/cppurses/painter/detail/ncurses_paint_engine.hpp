@@ -2,58 +2,43 @@
 #define PAINTER_DETAIL_NCURSES_PAINT_ENGINE_HPP
 #include <cppurses/painter/attribute.hpp>
 #include <cppurses/painter/color.hpp>
+#include <cppurses/painter/detail/paint_engine.hpp>
 
 #include <cstddef>
 #include <cstdint>
 #include <string>
 
-// Paint_engine Concept Requires:
-// Concrete_engine(const Paint_buffer& buffer);
-// void move(std::size_t x, std::size_t y);
-// void show_cursor(bool show = true);
-// void hide_cursor(bool hide = true);
-// std::size_t screen_width();
-// std::size_t screen_height();
-// void clear_attributes();
-// void touch_all();
-// void set_ctrl_char(bool enable);
-// void set_rgb(Color c, std::int16_t r, std::int16_t g, std::int16_t b);
-// void put_string(const char* s);
-// void put_string(const std::string& sym);
-// void set_attribute(Attribute attr);
-// void set_background_color(Color c);
-// void set_foreground_color(Color c);
-// void refresh();
-// void put_glyph(const Glyph& g);
-// void put(std::size_t x, std::size_t y, const Glyph& g) {
-
 namespace cppurses {
-class Paint_buffer;
+class Brush;
 class Glyph;
 namespace detail {
 
-class NCurses_paint_engine {
-   public:
-    explicit NCurses_paint_engine(const Paint_buffer& buffer);
-    ~NCurses_paint_engine();
-
-    NCurses_paint_engine(const NCurses_paint_engine&) = delete;
-    NCurses_paint_engine(NCurses_paint_engine&&) = delete;
-    NCurses_paint_engine& operator=(const NCurses_paint_engine&) = delete;
-    NCurses_paint_engine& operator=(NCurses_paint_engine&&) = delete;
-
-    void set_rgb(Color c, std::int16_t r, std::int16_t g, std::int16_t b);
+// Sets up the terminal and ncurses input handling, used by every engine that
+// is paired with the NCurses_event_listener.
+void initialize_ncurses();
 
-    void put_glyph(const Glyph& g);
-    void put(std::size_t x, std::size_t y, const Glyph& g);
-
-    void show_cursor(bool show = true);
-    void hide_cursor(bool hide = true);
-    std::size_t screen_width();
-    std::size_t screen_height();
-    void touch_all();
-
-    void move(std::size_t x, std::size_t y);
+class NCurses_paint_engine : public Paint_engine {
+   public:
+    NCurses_paint_engine();
+    ~NCurses_paint_engine() override;
+
+    void set_rgb(Color c,
+                 std::int16_t r,
+                 std::int16_t g,
+                 std::int16_t b) override;
+
+    void put_glyph(const Glyph& g) override;
+    void put_run(std::size_t x,
+                 std::size_t y,
+                 const Glyph* first,
+                 std::size_t length) override;
+
+    void show_cursor(bool show = true) override;
+    std::size_t screen_width() override;
+    std::size_t screen_height() override;
+    void touch_all() override;
+
+    void move(std::size_t x, std::size_t y) override;
     void put_string(const char* s);
     void put_string(const std::string& s);
 
@@ -62,12 +47,15 @@ class NCurses_paint_engine {
     void set_background_color(Color c);
     void set_foreground_color(Color c);
 
-    void refresh();
+    void refresh() override;
 
    private:
-    Color current_foreground();
-    Color current_background();
-    const Paint_buffer& buffer_;
+    void set_brush(const Brush& brush);
+
+    // Colors of the current color pair, pair 0 is black on black.
+    Color foreground_{Color::Black};
+    Color background_{Color::Black};
+    std::string run_;
 };
 
 }  // namespace detail
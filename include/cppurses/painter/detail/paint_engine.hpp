@@ -0,0 +1,59 @@
+#ifndef PAINTER_DETAIL_PAINT_ENGINE_HPP
+#define PAINTER_DETAIL_PAINT_ENGINE_HPP
+#include <cppurses/painter/color.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cppurses {
+class Glyph;
+namespace detail {
+
+// Output backend of a Paint_buffer. The buffer decides which cells changed,
+// the engine decides how to get them onto the screen.
+class Paint_engine {
+   public:
+    Paint_engine() = default;
+    Paint_engine(const Paint_engine&) = delete;
+    Paint_engine(Paint_engine&&) = delete;
+    Paint_engine& operator=(const Paint_engine&) = delete;
+    Paint_engine& operator=(Paint_engine&&) = delete;
+    virtual ~Paint_engine() = default;
+
+    virtual void set_rgb(Color c,
+                         std::int16_t r,
+                         std::int16_t g,
+                         std::int16_t b) = 0;
+
+    // Puts the Glyph at the current cursor position.
+    virtual void put_glyph(const Glyph& g) = 0;
+    void put(std::size_t x, std::size_t y, const Glyph& g) {
+        this->move(x, y);
+        this->put_glyph(g);
+    }
+
+    // Puts length Glyphs, starting at (x, y), that all share the same Brush.
+    // Each takes up one column, except the last, which may be wide.
+    virtual void put_run(std::size_t x,
+                         std::size_t y,
+                         const Glyph* first,
+                         std::size_t length) = 0;
+
+    virtual void show_cursor(bool show = true) = 0;
+    void hide_cursor(bool hide = true) { this->show_cursor(!hide); }
+
+    virtual std::size_t screen_width() = 0;
+    virtual std::size_t screen_height() = 0;
+
+    // Forget any assumptions about what is currently on the screen.
+    virtual void touch_all() = 0;
+
+    virtual void move(std::size_t x, std::size_t y) = 0;
+
+    // Makes everything put since the last refresh visible.
+    virtual void refresh() = 0;
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // PAINTER_DETAIL_PAINT_ENGINE_HPP
@@ -0,0 +1,64 @@
+#ifndef PAINTER_DETAIL_UTF8_HPP
+#define PAINTER_DETAIL_UTF8_HPP
+#include <cstddef>
+
+namespace cppurses {
+namespace detail {
+
+// Stored by decode_utf8() for a malformed sequence. Not a code point.
+const char32_t invalid_code_point{0xFFFFFFFF};
+
+// Decodes the code point at the start of bytes, of which there are length,
+// into code. Returns how many bytes it takes up. Overlong forms, surrogates
+// and values past U+10FFFF are malformed, code is then invalid_code_point and
+// the longest prefix that could have started a valid sequence is skipped, at
+// least one byte. length must not be zero.
+inline std::size_t decode_utf8(const char* bytes,
+                               std::size_t length,
+                               char32_t& code) {
+    const auto lead = static_cast<unsigned char>(bytes[0]);
+    if (lead < 0x80) {
+        code = lead;
+        return 1;
+    }
+    std::size_t count{0};
+    // Range of the second byte, narrower than 0x80-0xBF after some leads.
+    unsigned char low{0x80};
+    unsigned char high{0xBF};
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        count = 2;
+        code = lead & 0x1F;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        count = 3;
+        code = lead & 0x0F;
+        low = lead == 0xE0 ? 0xA0 : low;
+        high = lead == 0xED ? 0x9F : high;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        count = 4;
+        code = lead & 0x07;
+        low = lead == 0xF0 ? 0x90 : low;
+        high = lead == 0xF4 ? 0x8F : high;
+    } else {
+        code = invalid_code_point;
+        return 1;
+    }
+    for (std::size_t i{1}; i < count; ++i) {
+        if (i == length) {
+            code = invalid_code_point;
+            return i;
+        }
+        const auto byte = static_cast<unsigned char>(bytes[i]);
+        if (byte < low || byte > high) {
+            code = invalid_code_point;
+            return i;
+        }
+        code = (code << 6) | (byte & 0x3F);
+        low = 0x80;
+        high = 0xBF;
+    }
+    return count;
+}
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // PAINTER_DETAIL_UTF8_HPP
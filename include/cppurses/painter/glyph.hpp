@@ -3,15 +3,26 @@
 #include <cppurses/painter/brush.hpp>
 
 #include <array>
+#include <cstddef>
 #include <ostream>
 #include <stdexcept>
 #include <string>
 #include <utility>
 
 namespace cppurses {
-
+class Glyph;
+namespace detail {
+struct Cell;
+Cell to_cell(const Glyph& g);
+void set_symbol(Glyph& g, const Cell& c);
+}  // namespace detail
+
+// Symbol and Brush of a single terminal cell. Symbols of up to four bytes are
+// stored inline, longer ones, such as combining sequences, are interned in the
+// detail::Grapheme_table, so any symbol fits and copies never allocate.
 class Glyph {
    public:
+    // No longer thrown, symbols of any length are accepted.
     using Length_error = std::runtime_error;
 
     Glyph() = default;
@@ -19,7 +30,9 @@ class Glyph {
     // Implcit conversions are allowed.
     template <typename... Attributes>
     Glyph(char symbol, Attributes&&... attrs)  // NOLINT
-        : brush_{std::forward<Attributes>(attrs)...}, symbol_{{symbol, '\0'}} {}
+        : brush_{std::forward<Attributes>(attrs)...} {
+        this->set_symbol(symbol);
+    }
 
     template <typename... Attributes>
     Glyph(const char* symbol, Attributes&&... attrs)  // NOLINT
@@ -48,9 +61,19 @@ class Glyph {
     void set_symbol(char symbol);
     void set_symbol(const char* symbol);
     void set_symbol(const std::string& symbol);
+    // The first length bytes of symbol, which need not be null terminated.
+    void set_symbol(const char* symbol, std::size_t length);
 
     std::string str() const;
     const char* c_str() const;
+
+    // Terminal columns the symbol takes up, 1 or 2.
+    std::size_t width() const {
+        // Nothing below U+1100, the first wide code point, is wide.
+        return static_cast<unsigned char>(symbol_[0]) < 0xE1
+                   ? 1
+                   : this->lookup_width();
+    }
     operator std::string() const { return this->str(); }  // NOLINT
 
     void set_brush(const Brush& brush) { brush_ = brush; }
@@ -60,7 +83,16 @@ class Glyph {
 
    private:
     Brush brush_;
+    // Inline UTF-8 padded with zeros, or detail::grapheme_id_marker followed
+    // by a Grapheme_table id. Equal symbols always have equal bytes.
     std::array<char, 5> symbol_{"\0\0\0\0"};
+
+    std::size_t lookup_width() const;
+    bool interned() const;
+
+    friend bool operator==(const Glyph& lhs, const Glyph& rhs);
+    friend detail::Cell detail::to_cell(const Glyph& g);
+    friend void detail::set_symbol(Glyph& g, const detail::Cell& c);
 };
 
 bool operator==(const Glyph& lhs, const Glyph& rhs);
@@ -8,10 +8,13 @@
 
 namespace cppurses {
 
+// Row-major, contiguous storage. Each row is width() Glyphs long and rows
+// follow each other directly, so row(y) + width() == row(y + 1).
 class Glyph_matrix {
    public:
     explicit Glyph_matrix(std::size_t width = 0, std::size_t height = 0);
 
+    // Keeps the Glyphs that fit in the new dimensions, new cells are " ".
     void resize(std::size_t width, std::size_t height);
     void clear();
 
@@ -24,8 +27,17 @@ class Glyph_matrix {
     Glyph& at(std::size_t x, std::size_t y);
     const Glyph& at(std::size_t x, std::size_t y) const;
 
+    // Pointer to the first Glyph of row y, the row is width() Glyphs long.
+    Glyph* row(std::size_t y);
+    const Glyph* row(std::size_t y) const;
+
+    Glyph* data();
+    const Glyph* data() const;
+
    private:
-    std::vector<std::vector<Glyph>> matrix_;
+    std::vector<Glyph> matrix_;
+    std::size_t width_{0};
+    std::size_t height_{0};
 };
 
 }  // namespace cppurses
@@ -1,10 +1,11 @@
 #ifndef PAINTER_GLYPH_STRING_HPP
 #define PAINTER_GLYPH_STRING_HPP
+#include <cppurses/painter/brush.hpp>
 #include <cppurses/painter/glyph.hpp>
 
-#include <codecvt>
+#include <cstddef>
+#include <cstring>
 #include <initializer_list>
-#include <locale>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -68,17 +69,14 @@ class Glyph_string : private std::vector<Glyph> {
         return *this;
     }
 
-    // Multi-byte char compatibility.
-    // Converts to char32 string, then converts each char32 to a byte string
+    // UTF-8, one Glyph per code point. Zero width code points, such as
+    // combining marks, and code points after a zero width joiner are added to
+    // the Glyph before them. Malformed bytes become U+FFFD.
     template <typename... Attributes>
     Glyph_string& append(const char* symbols, Attributes&&... attrs) {
-        std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> converter;
-        std::u32string wide_string = converter.from_bytes(symbols);
-        reserve(this->size() + wide_string.size());
-        for (char32_t sym : wide_string) {
-            this->append(Glyph{converter.to_bytes(sym)},
-                         std::forward<Attributes>(attrs)...);
-        }
+        Brush brush;
+        brush.add_attributes(std::forward<Attributes>(attrs)...);
+        this->append_utf8(symbols, std::strlen(symbols), brush);
         return *this;
     }
 
@@ -148,6 +146,11 @@ class Glyph_string : private std::vector<Glyph> {
     using std::vector<Glyph>::pop_back;
     using std::vector<Glyph>::resize;
     using std::vector<Glyph>::swap;
+
+   private:
+    void append_utf8(const char* symbols,
+                     std::size_t length,
+                     const Brush& brush);
 };
 
 bool operator==(const Glyph_string& x, const Glyph_string& y);
@@ -1,20 +1,34 @@
 #ifndef PAINTER_DETAIL_PAINT_BUFFER_HPP
 #define PAINTER_DETAIL_PAINT_BUFFER_HPP
 #include <cppurses/painter/color.hpp>
-#include <cppurses/painter/detail/ncurses_paint_engine.hpp>
-#include <cppurses/painter/glyph_matrix.hpp>
+#include <cppurses/painter/detail/cell.hpp>
+#include <cppurses/painter/detail/paint_engine.hpp>
+#include <cppurses/painter/glyph.hpp>
 #include <cppurses/painter/palette.hpp>
 
 #include <cstddef>
+#include <memory>
+#include <vector>
 
 namespace cppurses {
-class Glyph;
 
 class Paint_buffer {
    public:
+    // Uses the NCurses_paint_engine.
     Paint_buffer();
+    explicit Paint_buffer(std::unique_ptr<detail::Paint_engine> engine);
 
+    // A wide glyph also stages the continuation cell after it, at the last
+    // column it is staged as a space instead.
     void stage(std::size_t x, std::size_t y, const Glyph& glyph);
+
+    // Staged cells [x, x + length) of row y, to be written in place. length
+    // is clipped to the screen, the returned cells are all marked as staged.
+    // A wide cell is followed by its continuation_of() cell.
+    detail::Cell* stage_span(std::size_t x,
+                             std::size_t y,
+                             std::size_t& length);
+
     void flush(bool optimize);
     void move(std::size_t x, std::size_t y);
 
@@ -22,14 +36,37 @@ class Paint_buffer {
     std::size_t update_height();
 
     void set_color(Color c, RGB values);
-    const Glyph& at(std::size_t x, std::size_t y) const;
+    Glyph at(std::size_t x, std::size_t y) const;
 
    private:
-    detail::NCurses_paint_engine engine_{*this};
-    Glyph_matrix backing_store_;
-    Glyph_matrix staging_area_;
+    std::unique_ptr<detail::Paint_engine> engine_;
+    detail::Cell_matrix backing_store_;
+    detail::Cell_matrix staging_area_;
+    // Cells of a run, turned back into Glyphs for the engine.
+    std::vector<Glyph> run_;
+
+    // Half open range [first, last) of cells staged since the last flush.
+    struct Dirty_span {
+        std::size_t first;
+        std::size_t last;
+    };
+
+    // One span per row, plus the rows that have a non-empty span.
+    std::vector<Dirty_span> dirty_spans_;
+    std::vector<std::size_t> dirty_rows_;
+
+    // The screen was resized, its contents can no longer be trusted.
+    bool repaint_all_{false};
 
-    bool commit(std::size_t x, std::size_t y);
+    void stage_wide(std::size_t x, std::size_t y, detail::Cell cell);
+    void flush_row(std::size_t y,
+                   std::size_t first,
+                   std::size_t last,
+                   bool optimize);
+    // Sends the backing store Cells [first, last) of row y to the engine.
+    void put_span(std::size_t y, std::size_t first, std::size_t last);
+    void mark_dirty(std::size_t x, std::size_t y);
+    void clear_dirty();
     void resize(std::size_t width, std::size_t height);
 };
 
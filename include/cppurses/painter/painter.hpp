@@ -9,6 +9,9 @@ namespace cppurses {
 struct Border;
 class Glyph;
 class Widget;
+namespace detail {
+class Glyph_rope;
+}  // namespace detail
 
 class Painter {
    public:
@@ -18,6 +21,16 @@ class Painter {
     void put(const Glyph_string& text, std::size_t x, std::size_t y);
     void put(const Glyph_string& text);
 
+    // Paints length Glyphs of text from index on, left to right from local
+    // (x, y), straight into the paint buffer. Clipped to the Widget, a wide
+    // Glyph cut off by the edge is painted as a space. The cursor is not
+    // moved and newlines are not interpreted.
+    void put(const detail::Glyph_rope& text,
+             std::size_t index,
+             std::size_t length,
+             std::size_t x,
+             std::size_t y);
+
     bool move_cursor_on_put{false};
 
     // Convinience functions
@@ -1,6 +1,10 @@
 #ifndef SYSTEM_DETAIL_ABSTRACT_EVENT_LISTENER_HPP
 #define SYSTEM_DETAIL_ABSTRACT_EVENT_LISTENER_HPP
+#include <cppurses/system/event.hpp>
+
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace cppurses {
 class Event;
@@ -8,7 +12,27 @@ namespace detail {
 
 class Abstract_event_listener {
    public:
+    virtual ~Abstract_event_listener() = default;
+
+    // Does not block, returns nullptr once no more input is available.
     virtual std::unique_ptr<Event> get_input() const = 0;
+
+    // Every Event currently available, in the order the input arrived. Does
+    // not block. Used by the Event_loop when file_descriptor() is readable.
+    virtual std::vector<std::unique_ptr<Event>> get_inputs() const {
+        std::vector<std::unique_ptr<Event>> events;
+        auto event = this->get_input();
+        while (event != nullptr) {
+            events.push_back(std::move(event));
+            event = this->get_input();
+        }
+        return events;
+    }
+
+    // The Event_loop waits for this to become readable before calling
+    // get_input(). If negative, get_input() is called once per iteration.
+    virtual int file_descriptor() const { return -1; }
+
     virtual void enable_ctrl_characters() = 0;
     virtual void disable_ctrl_characters() = 0;
 };
@@ -12,6 +12,18 @@ class Event_invoker {
     void invoke(Event_queue& queue,
                 Event::Type type_filter = Event::None,
                 Event_handler* object_filter = nullptr);
+
+    // Sends every Event but DeferredDelete Events and those of type excluded,
+    // which stay in the queue in the order they were posted.
+    void invoke_except(Event_queue& queue, Event::Type excluded);
+
+   private:
+    // Sends Events for which predicate(event) is true in batches, until none
+    // are left. take_all skips the scan when every Event matches.
+    template <typename Predicate>
+    void invoke_matching(Event_queue& queue,
+                         bool take_all,
+                         Predicate predicate);
 };
 
 }  // namespace detail
@@ -1,20 +1,69 @@
 #ifndef SYSTEM_DETAIL_EVENT_QUEUE_HPP
 #define SYSTEM_DETAIL_EVENT_QUEUE_HPP
+#include <cppurses/system/event.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <list>
 #include <memory>
-#include <vector>
+#include <unordered_map>
 
 namespace cppurses {
-class Event;
+class Event_handler;
+class Widget;
 namespace detail {
 
+// Events in the order they were posted. Paint, Move, Resize and ClearScreen
+// Events are coalesced per (receiver, type), the newest Event replaces the
+// pending one and moves to the back of the queue. DeferredDelete Events are
+// coalesced per Widget to delete and replace those of any of its children,
+// they are dropped if a parent is already waiting to be deleted.
 class Event_queue {
    public:
     void append(std::unique_ptr<Event> event);
+    bool empty() const { return queue_.empty(); }
+    std::size_t size() const { return queue_.size(); }
     friend class Event_invoker;
 
    private:
-    std::vector<std::unique_ptr<Event>> queue_;
-    void remove_dd_children(const Event& new_event);
+    using Queue_t = std::list<std::unique_ptr<Event>>;
+
+    struct Key {
+        Event_handler* receiver;
+        Event::Type type;
+        bool operator==(const Key& other) const {
+            return receiver == other.receiver && type == other.type;
+        }
+    };
+
+    struct Key_hash {
+        std::size_t operator()(const Key& key) const {
+            return std::hash<Event_handler*>{}(key.receiver) ^
+                   (static_cast<std::size_t>(key.type) << 1);
+        }
+    };
+
+    // An Event in the queue, or in an Event_invoker batch waiting to be sent.
+    // A replaced Event in a batch is reset to nullptr instead of erased.
+    struct Entry {
+        Queue_t::iterator position;
+        bool in_batch;
+    };
+
+    Queue_t queue_;
+    std::unordered_map<Key, Entry, Key_hash> coalesced_;
+    std::unordered_map<const Widget*, Entry> deferred_deletes_;
+
+    // Moves the Event at position to the back of batch.
+    void move_to(Queue_t& batch, Queue_t::iterator position);
+    void move_all_to(Queue_t& batch);
+    // Called for each Event of a batch before it is sent, from then on it can
+    // no longer be replaced.
+    void release(const Event& event);
+
+    void remove(const Entry& entry);
+    void remove_dd_children(const Widget* parent);
+    bool parent_pending_delete(const Widget* w) const;
 };
 
 }  // namespace detail
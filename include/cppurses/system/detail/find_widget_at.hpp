@@ -0,0 +1,24 @@
+#ifndef SYSTEM_DETAIL_FIND_WIDGET_AT_HPP
+#define SYSTEM_DETAIL_FIND_WIDGET_AT_HPP
+#include <cstddef>
+
+namespace cppurses {
+class Widget;
+namespace detail {
+
+// Returns the enabled Widget at global coordinates (x, y), or nullptr.
+// Answered from a detail::Hit_grid, which is kept current by the functions
+// below.
+Widget* find_widget_at(std::size_t x, std::size_t y);
+
+// Call with the cells w covers before and after its position or size
+// changes.
+void invalidate_hit_area(const Widget& w);
+
+// Call when the Widget tree, or whether a Widget is enabled or visible,
+// changes.
+void invalidate_hit_grid();
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // SYSTEM_DETAIL_FIND_WIDGET_AT_HPP
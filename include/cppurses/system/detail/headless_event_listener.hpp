@@ -0,0 +1,54 @@
+#ifndef SYSTEM_DETAIL_HEADLESS_EVENT_LISTENER_HPP
+#define SYSTEM_DETAIL_HEADLESS_EVENT_LISTENER_HPP
+#include <cppurses/system/detail/abstract_event_listener.hpp>
+#include <cppurses/system/key.hpp>
+#include <cppurses/system/mouse_button.hpp>
+#include <cppurses/widget/point.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+
+namespace cppurses {
+class Event;
+namespace detail {
+
+// Replays a scripted sequence of input instead of reading from a terminal.
+// Receivers are looked up when an input is taken from the script, the same
+// way the NCurses_event_listener does it. Once the script is exhausted the
+// System is told to exit.
+class Headless_event_listener : public Abstract_event_listener {
+   public:
+    std::unique_ptr<Event> get_input() const override;
+    void enable_ctrl_characters() override {}
+    void disable_ctrl_characters() override {}
+
+    void push_key(Key key);
+    // One Key_press_event per char of text.
+    void push_keys(const std::string& text);
+    void push_mouse_press(Mouse_button button, Point global);
+    void push_mouse_release(Mouse_button button, Point global);
+    // Resize_event to System::head() with the current screen dimensions.
+    void push_resize();
+    // A single Paste_event to the focus Widget.
+    void push_paste(std::string text);
+
+    bool empty() const { return script_.empty(); }
+    std::size_t size() const { return script_.size(); }
+
+   private:
+    struct Input {
+        enum Kind { Key_press, Mouse_press, Mouse_release, Resize, Paste };
+        Kind kind;
+        Key key;
+        Mouse_button button;
+        Point position;
+        std::string text{};
+    };
+    mutable std::deque<Input> script_;
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // SYSTEM_DETAIL_HEADLESS_EVENT_LISTENER_HPP
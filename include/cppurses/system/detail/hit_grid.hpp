@@ -0,0 +1,47 @@
+#ifndef SYSTEM_DETAIL_HIT_GRID_HPP
+#define SYSTEM_DETAIL_HIT_GRID_HPP
+#include <cstddef>
+#include <vector>
+
+namespace cppurses {
+class Widget;
+namespace detail {
+
+// Per-cell index of the Widget found at each global coordinate. Built by
+// writing each enabled and visible Widget over the cells it covers, parents
+// before children and, among siblings, the first child last, so a lookup
+// gives the same Widget as descending from the head through the first child
+// that contains the point. Only invalidated areas are rebuilt.
+class Hit_grid {
+   public:
+    // nullptr if no Widget under head covers (x, y).
+    Widget* at(Widget* head, std::size_t x, std::size_t y);
+
+    // Marks the cells w covers right now for re-indexing.
+    void invalidate(const Widget& w);
+    void invalidate_all();
+
+   private:
+    struct Rect {
+        std::size_t x;
+        std::size_t y;
+        std::size_t width;
+        std::size_t height;
+    };
+
+    std::vector<Widget*> owners_;
+    std::size_t width_{0};
+    std::size_t height_{0};
+    const Widget* head_{nullptr};
+
+    std::vector<Rect> dirty_;
+    bool all_dirty_{true};
+
+    void rebuild(Widget& head);
+    void rebuild(Widget& head, Rect area);
+    void fill(Widget& w, Rect clip);
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // SYSTEM_DETAIL_HIT_GRID_HPP
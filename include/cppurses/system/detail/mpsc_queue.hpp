@@ -0,0 +1,66 @@
+#ifndef SYSTEM_DETAIL_MPSC_QUEUE_HPP
+#define SYSTEM_DETAIL_MPSC_QUEUE_HPP
+#include <atomic>
+#include <utility>
+
+namespace cppurses {
+namespace detail {
+
+// Unbounded lock-free multi-producer single-consumer FIFO, after Dmitry
+// Vyukov's intrusive node queue. push() is wait-free and can be called from
+// any thread, pop() must only be called from a single consumer thread. A
+// value pushed while pop() runs might only be seen by the next pop() call.
+template <typename T>
+class Mpsc_queue {
+   public:
+    Mpsc_queue() : head_{new Node}, tail_{head_.load()} {}
+    Mpsc_queue(const Mpsc_queue&) = delete;
+    Mpsc_queue& operator=(const Mpsc_queue&) = delete;
+
+    ~Mpsc_queue() {
+        while (tail_ != nullptr) {
+            Node* next{tail_->next.load(std::memory_order_relaxed)};
+            delete tail_;
+            tail_ = next;
+        }
+    }
+
+    void push(T value) {
+        Node* node{new Node{std::move(value)}};
+        Node* previous{head_.exchange(node, std::memory_order_acq_rel)};
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    // Moves the oldest value into out, returns false if the queue is empty.
+    bool pop(T& out) {
+        Node* next{tail_->next.load(std::memory_order_acquire)};
+        if (next == nullptr) {
+            return false;
+        }
+        // next becomes the new stub node, its value is moved from.
+        out = std::move(next->value);
+        delete tail_;
+        tail_ = next;
+        return true;
+    }
+
+    bool empty() const {
+        return tail_->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+   private:
+    struct Node {
+        Node() = default;
+        explicit Node(T v) : value{std::move(v)} {}
+        std::atomic<Node*> next{nullptr};
+        T value;
+    };
+
+    // Producers swap in new nodes at head_, the consumer reads from tail_.
+    std::atomic<Node*> head_;
+    Node* tail_;
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // SYSTEM_DETAIL_MPSC_QUEUE_HPP
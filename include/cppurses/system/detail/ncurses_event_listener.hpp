@@ -3,19 +3,47 @@
 #include <cppurses/system/detail/abstract_event_listener.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cppurses {
 class Widget;
 class Event;
 namespace detail {
 
+// Turns on the terminal's bracketed paste mode while it exists, pasted text
+// is delivered as a single Paste_event to the focus Widget.
 class NCurses_event_listener : public Abstract_event_listener {
    public:
+    NCurses_event_listener();
+    NCurses_event_listener(const NCurses_event_listener&) = delete;
+    NCurses_event_listener& operator=(const NCurses_event_listener&) = delete;
+    ~NCurses_event_listener() override;
+
     std::unique_ptr<Event> get_input() const override;
+    // Reads until getch() has nothing left, one pass for a paste or a burst
+    // of repeated keys.
+    std::vector<std::unique_ptr<Event>> get_inputs() const override;
+    int file_descriptor() const override;
     void enable_ctrl_characters() override;
     void disable_ctrl_characters() override;
 
    private:
+    // Pasted text is collected here until the end marker has been read, a
+    // paste can span several calls to get_inputs().
+    mutable std::string paste_;
+    mutable bool in_paste_{false};
+
+    // nullptr once getch() has nothing left.
+    std::unique_ptr<Event> next_event() const;
+    // Called after an escape was read. Consumes the rest of the paste start
+    // marker, or puts back what it has read if this is not one.
+    bool paste_begins() const;
+    // nullptr if the paste end marker has not arrived yet.
+    std::unique_ptr<Event> read_paste() const;
+
+    // nullptr if input does not translate to an Event.
+    std::unique_ptr<Event> make_event(int input) const;
     std::unique_ptr<Event> parse_mouse_event() const;
 
     std::unique_ptr<Event> handle_keyboard_event(int input) const;
@@ -0,0 +1,79 @@
+#ifndef SYSTEM_DETAIL_TIMER_WHEEL_HPP
+#define SYSTEM_DETAIL_TIMER_WHEEL_HPP
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace cppurses {
+class Event_handler;
+namespace detail {
+
+// Hierarchical timer wheel with millisecond resolution. The first level has
+// one slot per millisecond for the next 256ms, each further level covers 64
+// times the span of the one below and is cascaded down as time passes. Adding
+// and removing a timer is O(1), removed timers are skipped when their slot
+// comes up.
+class Timer_wheel {
+   public:
+    using Clock = std::chrono::steady_clock;
+    using Id = std::size_t;
+
+    struct Expired {
+        Event_handler* receiver;
+        Id id;
+    };
+
+    explicit Timer_wheel(Clock::time_point start = Clock::now());
+
+    Id add(Event_handler* receiver,
+           std::chrono::milliseconds interval,
+           bool repeating,
+           Clock::time_point now = Clock::now());
+    void remove(Id id);
+    bool contains(Id id) const { return timers_.count(id) != 0; }
+    bool empty() const { return timers_.empty(); }
+
+    // Moves the wheel forward to now, appending every timer that came due.
+    void advance(std::vector<Expired>& due,
+                 Clock::time_point now = Clock::now());
+
+    // Milliseconds until advance() should next be called, -1 if no timers
+    // are running. May be early, never late.
+    int next_timeout(Clock::time_point now = Clock::now()) const;
+
+   private:
+    struct Timer {
+        Event_handler* receiver;
+        std::uint64_t interval;
+        bool repeating;
+    };
+
+    struct Entry {
+        Id id;
+        std::uint64_t expires;
+    };
+
+    using Slot = std::vector<Entry>;
+
+    Clock::time_point start_;
+    std::uint64_t tick_{0};
+    Id next_id_{1};
+    std::unordered_map<Id, Timer> timers_;
+
+    // level0_ holds timers due in the next 256 ticks, upper_levels_[i] in the
+    // next 2^(14 + 6i) ticks.
+    std::array<Slot, 256> level0_;
+    std::array<std::array<Slot, 64>, 3> upper_levels_;
+    Slot expiring_;
+
+    std::uint64_t to_tick(Clock::time_point t) const;
+    void insert(Entry entry, bool cascading = false);
+    void cascade(std::size_t level);
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // SYSTEM_DETAIL_TIMER_WHEEL_HPP
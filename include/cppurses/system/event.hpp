@@ -30,8 +30,9 @@ class Event {
         ChildPolished,
         Enable,
         Disable,
-        DeferredDelete
-        // Timer,
+        DeferredDelete,
+        Timer,
+        Paste
         // Enter,
         // Leave,
         // Create,
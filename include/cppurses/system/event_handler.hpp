@@ -5,9 +5,11 @@
 #include <cppurses/widget/area.hpp>
 #include <cppurses/widget/point.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <signals/signal.hpp>
+#include <string>
 #include <vector>
 
 namespace cppurses {
@@ -30,6 +32,12 @@ class Event_handler {
     void remove_event_filter(Event_handler* filter);
     const std::vector<Event_handler*>& get_event_filters() const;
 
+    // Timers, a Timer_event with the returned id is sent to this each time
+    // interval passes. Running timers are stopped on destruction.
+    std::size_t start_timer(std::chrono::milliseconds interval,
+                            bool repeating = true);
+    void stop_timer(std::size_t timer_id);
+
     // - - - - - - - - - - - - - Event Handlers - - - - - - - - - - - - - - - -
     virtual bool child_added_event(Widget* child) = 0;
     virtual bool child_removed_event(Widget* child) = 0;
@@ -69,6 +77,8 @@ class Event_handler {
     virtual bool deferred_delete_event(Event_handler* to_delete) = 0;
     virtual bool paint_event() = 0;
     virtual bool clear_screen_event() = 0;
+    virtual bool timer_event(std::size_t timer_id);
+    virtual bool paste_event(const std::string& text);
 
     // - - - - - - - - - - - Event Filter Handlers - - - - - - - - - - - - - - -
     virtual bool child_added_event_filter(Event_handler* receiver,
@@ -126,6 +136,10 @@ class Event_handler {
                                               Event_handler* to_delete);
     virtual bool paint_event_filter(Event_handler* receiver);
     virtual bool clear_screen_event_filter(Event_handler* receiver);
+    virtual bool timer_event_filter(Event_handler* receiver,
+                                    std::size_t timer_id);
+    virtual bool paste_event_filter(Event_handler* receiver,
+                                    const std::string& text);
 
     // Signals
     sig::Signal<void(Event_handler*)> destroyed;
@@ -140,6 +154,7 @@ class Event_handler {
 
    private:
     std::vector<Event_handler*> event_filters_;
+    std::vector<std::size_t> timers_;
     bool enabled_ = true;
 };
 
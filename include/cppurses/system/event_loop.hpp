@@ -2,21 +2,109 @@
 #define SYSTEM_EVENT_LOOP_HPP
 #include <cppurses/system/detail/event_invoker.hpp>
 #include <cppurses/system/detail/event_queue.hpp>
+#include <cppurses/system/detail/mpsc_queue.hpp>
+#include <cppurses/system/detail/timer_wheel.hpp>
+
+#include <signals/slot.hpp>
+
+#include <poll.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
 
 namespace cppurses {
+class Event;
+class Event_handler;
 
+// Sends queued Events, flushes the screen, then sleeps in poll() until there
+// is input, a watched file descriptor is readable, a timer is due or wake()
+// is called. All timers that are due are posted together as Timer_events.
+// Paint Events and the flush happen at most once per frame, between frames
+// only input and other Events are processed. A frame that is held back is
+// rendered as soon as its interval is up, or when the loop exits.
+// Events posted from other threads go through a lock-free queue and are moved
+// into event_queue at the start of the next iteration.
 class Event_loop {
    public:
+    Event_loop();
+    Event_loop(const Event_loop&) = delete;
+    Event_loop& operator=(const Event_loop&) = delete;
+    ~Event_loop();
+
     int run();
     void exit(int return_code);
+
+    // Interrupts a waiting loop. Safe to call from any thread, and from
+    // signal handlers.
+    void wake();
+
+    // Appends to event_queue when called from the thread running the loop,
+    // otherwise hands the Event to the loop thread and wakes it. Producers
+    // never take a lock.
+    void post(std::unique_ptr<Event> event);
+
+    // True if called from the thread that last called run(), or that
+    // constructed the loop if run() has not been called yet.
+    bool on_loop_thread() const;
+
+    // on_readable is called from the loop each time fd has data to read or
+    // hangs up. A second call with the same fd replaces the slot.
+    void watch_fd(int fd, sig::Slot<void()> on_readable);
+    void unwatch_fd(int fd);
+
+    // Caps how often the screen is painted and flushed, 0 removes the cap.
+    // The first frame after an idle period is always rendered at once.
+    void set_frame_rate(unsigned frames_per_second);
+
+    std::size_t start_timer(Event_handler* receiver,
+                            std::chrono::milliseconds interval,
+                            bool repeating);
+    void stop_timer(std::size_t timer_id);
+    bool timer_active(std::size_t timer_id) const;
+
     detail::Event_queue event_queue;
 
    private:
+    using Clock = std::chrono::steady_clock;
+
     void process_events();
+    void render();
+    // Milliseconds until the next frame can be rendered, 0 if it is due.
+    int frame_timeout(Clock::time_point now) const;
+    void wait_for_input();
+    void read_input();
+    void post_timer_events();
+    void take_posted_events();
 
     int return_code_ = 0;
     bool exit_ = false;
     detail::Event_invoker invoker_;
+
+    Clock::duration frame_interval_{std::chrono::microseconds{16667}};
+    Clock::time_point last_render_;
+    // Events were sent since the last flush.
+    bool render_pending_{false};
+
+    // Self-pipe, wake() writes a byte to make poll() return.
+    int wakeup_read_{-1};
+    int wakeup_write_{-1};
+
+    std::map<int, sig::Slot<void()>> watched_;
+    std::vector<::pollfd> poll_fds_;
+
+    detail::Timer_wheel timers_;
+    std::vector<detail::Timer_wheel::Expired> due_timers_;
+
+    std::atomic<std::thread::id> thread_id_{std::this_thread::get_id()};
+    detail::Mpsc_queue<std::unique_ptr<Event>> posted_;
+    // Set by the first post() since the loop last drained posted_, so only
+    // one wake() call is made per batch of cross-thread Events.
+    std::atomic<bool> wake_pending_{false};
 };
 
 }  // namespace cppurses
@@ -0,0 +1,25 @@
+#ifndef SYSTEM_EVENTS_PASTE_EVENT_HPP
+#define SYSTEM_EVENTS_PASTE_EVENT_HPP
+#include <cppurses/system/event.hpp>
+#include <cppurses/system/events/input_event.hpp>
+
+#include <string>
+
+namespace cppurses {
+class Event_handler;
+
+// Text pasted into the terminal, delivered in one piece. Line breaks are
+// '\n'. If the receiver does not handle paste_event(), the text is sent to
+// key_press_event() one char at a time.
+class Paste_event : public Input_event {
+   public:
+    Paste_event(Event_handler* receiver, std::string text);
+    bool send() const override;
+    bool filter_send(Event_handler* filter) const override;
+
+   private:
+    std::string text_;
+};
+
+}  // namespace cppurses
+#endif  // SYSTEM_EVENTS_PASTE_EVENT_HPP
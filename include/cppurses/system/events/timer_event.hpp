@@ -0,0 +1,21 @@
+#ifndef SYSTEM_EVENTS_TIMER_EVENT_HPP
+#define SYSTEM_EVENTS_TIMER_EVENT_HPP
+#include <cppurses/system/event.hpp>
+
+#include <cstddef>
+
+namespace cppurses {
+class Event_handler;
+
+class Timer_event : public Event {
+   public:
+    Timer_event(Event_handler* receiver, std::size_t timer_id);
+    bool send() const override;
+    bool filter_send(Event_handler* filter) const override;
+
+   private:
+    std::size_t timer_id_;
+};
+
+}  // namespace cppurses
+#endif  // SYSTEM_EVENTS_TIMER_EVENT_HPP
@@ -4,21 +4,30 @@
 
 #include <signals/slot.hpp>
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <utility>
 
 namespace cppurses {
 namespace detail {
 class Abstract_event_listener;
+class Paint_engine;
 }  // namespace detail
 class Widget;
 class Event;
+class Event_handler;
 class Paint_buffer;
 class Palette;
 
 class System {
    public:
+    // Uses the NCurses_paint_engine and the NCurses_event_listener.
     System();
+    // The engine and listener are owned by the System until it is destroyed,
+    // see Headless_paint_engine and Headless_event_listener.
+    System(std::unique_ptr<detail::Paint_engine> engine,
+           std::unique_ptr<detail::Abstract_event_listener> listener);
     System(const System&) = delete;
     System& operator=(const System&) = delete;
     System(System&&) noexcept = default;             // NOLINT
@@ -27,6 +36,8 @@ class System {
 
     int run();
 
+    // Can be called from any thread, Events posted from other threads are
+    // delivered on the thread running the Event_loop.
     static void post_event(std::unique_ptr<Event> event);
 
     template <typename T, typename... Args>
@@ -38,6 +49,23 @@ class System {
     static bool send_event(const Event& event);
 
     static void exit(int return_code = 0);
+
+    // on_readable is called from the event loop whenever fd has data, or is
+    // at end of file, in which case the slot should unwatch it.
+    static void watch_fd(int fd, sig::Slot<void()> on_readable);
+    static void unwatch_fd(int fd);
+
+    // Prefer Event_handler::start_timer(), which stops the timer when the
+    // receiver is destroyed.
+    static std::size_t start_timer(Event_handler* receiver,
+                                   std::chrono::milliseconds interval,
+                                   bool repeating = true);
+    static void stop_timer(std::size_t timer_id);
+    static bool timer_active(std::size_t timer_id);
+
+    // Screen updates per second, defaults to 60. 0 renders every iteration.
+    static void set_frame_rate(unsigned frames_per_second);
+
     static Widget* head();
     static unsigned max_width();
     static unsigned max_height();
@@ -0,0 +1,116 @@
+#ifndef WIDGET_CHILDREN_VIEW_HPP
+#define WIDGET_CHILDREN_VIEW_HPP
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace cppurses {
+class Widget;
+
+// Non-owning view of a Widget's children, iterated as Widget*. Does not
+// allocate, and is invalidated by adding or removing children, as with
+// iterators into the underlying std::vector.
+class Children_view {
+    using Container = std::vector<std::unique_ptr<Widget>>;
+
+   public:
+    class Iterator {
+       public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Widget*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Widget* const*;
+        using reference = Widget*;
+
+        Iterator() = default;
+        explicit Iterator(Container::const_iterator iter) : iter_{iter} {}
+
+        Widget* operator*() const { return iter_->get(); }
+        Widget* operator[](difference_type n) const { return iter_[n].get(); }
+
+        Iterator& operator++() {
+            ++iter_;
+            return *this;
+        }
+        Iterator operator++(int) { return Iterator{iter_++}; }
+        Iterator& operator--() {
+            --iter_;
+            return *this;
+        }
+        Iterator operator--(int) { return Iterator{iter_--}; }
+        Iterator& operator+=(difference_type n) {
+            iter_ += n;
+            return *this;
+        }
+        Iterator& operator-=(difference_type n) {
+            iter_ -= n;
+            return *this;
+        }
+        Iterator operator+(difference_type n) const {
+            return Iterator{iter_ + n};
+        }
+        Iterator operator-(difference_type n) const {
+            return Iterator{iter_ - n};
+        }
+        difference_type operator-(const Iterator& other) const {
+            return iter_ - other.iter_;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return iter_ == other.iter_;
+        }
+        bool operator!=(const Iterator& other) const {
+            return iter_ != other.iter_;
+        }
+        bool operator<(const Iterator& other) const {
+            return iter_ < other.iter_;
+        }
+        bool operator>(const Iterator& other) const {
+            return iter_ > other.iter_;
+        }
+        bool operator<=(const Iterator& other) const {
+            return iter_ <= other.iter_;
+        }
+        bool operator>=(const Iterator& other) const {
+            return iter_ >= other.iter_;
+        }
+
+       private:
+        Container::const_iterator iter_;
+    };
+
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = reverse_iterator;
+    using value_type = Widget*;
+    using size_type = std::size_t;
+
+    explicit Children_view(const Container& children) : children_{&children} {}
+
+    Iterator begin() const { return Iterator{std::begin(*children_)}; }
+    Iterator end() const { return Iterator{std::end(*children_)}; }
+    reverse_iterator rbegin() const { return reverse_iterator{this->end()}; }
+    reverse_iterator rend() const { return reverse_iterator{this->begin()}; }
+
+    std::size_t size() const { return children_->size(); }
+    bool empty() const { return children_->empty(); }
+    Widget* operator[](std::size_t index) const {
+        return (*children_)[index].get();
+    }
+    Widget* front() const { return children_->front().get(); }
+    Widget* back() const { return children_->back().get(); }
+
+    // Copy of the current children, for callers that modify the tree while
+    // iterating.
+    std::vector<Widget*> to_vector() const {
+        return std::vector<Widget*>(this->begin(), this->end());
+    }
+
+   private:
+    const Container* children_;
+};
+
+}  // namespace cppurses
+#endif  // WIDGET_CHILDREN_VIEW_HPP
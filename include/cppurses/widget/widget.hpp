@@ -6,6 +6,7 @@
 #include <cppurses/system/event_handler.hpp>
 #include <cppurses/system/key.hpp>
 #include <cppurses/widget/border.hpp>
+#include <cppurses/widget/children_view.hpp>
 #include <cppurses/widget/focus_policy.hpp>
 #include <cppurses/widget/point.hpp>
 #include <cppurses/widget/size_policy.hpp>
@@ -42,7 +43,7 @@ class Widget : public Event_handler {
     // Children
     void add_child(std::unique_ptr<Widget> child);
     void insert_child(std::unique_ptr<Widget> child, std::size_t index);
-    std::vector<Widget*> children() const;
+    Children_view children() const;
     bool contains_child(Widget* child);
 
     template <typename T, typename... Args>
@@ -55,6 +56,9 @@ class Widget : public Event_handler {
     std::unique_ptr<Widget> remove_child(const std::string& name);
 
     // Global Point(Including Border)
+    // Cached, moves, resizes, reparenting and enable_border()/disable_border()
+    // invalidate the cache of the Widget and everything below it. Border
+    // segments toggled directly take effect with the next resize.
     std::size_t x() const;
     std::size_t y() const;
 
@@ -133,6 +137,11 @@ class Widget : public Event_handler {
     // Top left corner, relative to parent's coordinates.
     Point position_;
 
+    // Cache of x() and y(). If invalid, the cache of every descendant is
+    // invalid too, as a valid cache is only ever computed from its parent's.
+    mutable Point global_position_;
+    mutable bool global_position_valid_{false};
+
     std::size_t width_{width_policy.hint()};
     std::size_t height_{height_policy.hint()};
 
@@ -144,6 +153,11 @@ class Widget : public Event_handler {
     // void delete_child(Widget* child);
     void set_x(std::size_t global_x);
     void set_y(std::size_t global_y);
+    void update_global_position() const;
+    void invalidate_global_position();
+
+    friend void enable_border(Widget& w);
+    friend void disable_border(Widget& w);
 };
 
 // - - - - - - - - - - - - - - Free Functions - - - - - - - - - - - - - - - - -
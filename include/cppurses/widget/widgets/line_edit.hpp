@@ -30,6 +30,9 @@ class Line_edit : public Textbox {
 
    protected:
     bool key_press_event(Key key, char symbol) override;
+    // Not handled, pasted text arrives as key presses so it is validated and
+    // Enter finishes editing.
+    bool paste_event(const std::string& text) override;
     bool mouse_press_event(Mouse_button button,
                            Point global,
                            Point local,
@@ -6,6 +6,8 @@
 
 #include <signals/slot.hpp>
 
+#include <string>
+
 namespace cppurses {
 
 class Log : public Textbox {
@@ -14,6 +16,7 @@ class Log : public Textbox {
 
    protected:
     bool key_press_event(Key key, char symbol) override;
+    bool paste_event(const std::string& text) override;
 
     using Text_display::append;
     using Text_display::erase;
@@ -2,6 +2,7 @@
 #define WIDGET_WIDGETS_TEXT_DISPLAY_HPP
 #include <cppurses/painter/attribute.hpp>
 #include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/detail/glyph_rope.hpp>
 #include <cppurses/painter/glyph.hpp>
 #include <cppurses/painter/glyph_string.hpp>
 #include <cppurses/widget/point.hpp>
@@ -53,7 +54,8 @@ class Text_display : public Widget {
     std::size_t index_at(Point position) const;
     std::size_t index_at(std::size_t x, std::size_t y) const;
     Point display_position(std::size_t index) const;
-    Glyph_string contents() const { return contents_; }
+    // Copies the whole text, glyph_at() reads a single Glyph.
+    Glyph_string contents() const { return contents_.str(); }
     Glyph glyph_at(std::size_t index) const { return contents_.at(index); }
     std::size_t contents_size() const { return contents_.size(); }
     bool contents_empty() const { return contents_.empty(); }
@@ -63,7 +65,8 @@ class Text_display : public Widget {
     sig::Signal<void(std::size_t n)> scrolled_up;
     sig::Signal<void(std::size_t n)> scrolled_down;
     sig::Signal<void()> scrolled;
-    sig::Signal<void(const Glyph_string&)> text_changed;
+    // Emitted after every change to the text, contents() has the new text.
+    sig::Signal<void()> text_changed;
 
    protected:
     bool paint_event() override;
@@ -80,19 +83,45 @@ class Text_display : public Widget {
     std::size_t line_length(std::size_t line) const;
     std::size_t end_index() const;
 
+    // Rewraps every line from from_line to the end of the contents.
     void update_display(std::size_t from_line = 0);
 
    private:
     struct Line_info {
         std::size_t start_index;
         std::size_t length;
+        // Terminal columns the line takes up, wide glyphs count twice.
+        std::size_t columns;
     };
 
-    std::vector<Line_info> display_state_{Line_info{0, 0}};
+    // Rewraps after removed glyphs at index were replaced by added glyphs.
+    // Starts at the first line whose break could see index and stops once a
+    // new line starts where an old line past the edit started.
+    void rewrap(std::size_t index, std::size_t removed, std::size_t added);
+
+    // Wraps the line starting at start into line. Returns the index the next
+    // line starts at, or Glyph_string::npos if this is the last line.
+    std::size_t wrap_line(std::size_t start, Line_info& line) const;
+
+    std::size_t line_start(std::size_t line) const;
+
+    // Columns taken up by the glyphs in [first, last).
+    std::size_t columns(std::size_t first, std::size_t last) const;
+    void move_shift_to(std::size_t line);
+
+    std::vector<Line_info> display_state_{Line_info{0, 0, 0}};
+
+    // Lines from shift_from_ on store start_index minus shift_by_, so an edit
+    // only touches the lines between it and the previous edit.
+    std::size_t shift_from_{0};
+    std::size_t shift_by_{0};
+
+    // width() display_state_ was wrapped for.
+    std::size_t wrap_width_{0};
 
     std::size_t top_line_{0};
     bool word_wrap_ = true;
-    Glyph_string contents_;
+    detail::Glyph_rope contents_;
     Brush new_text_brush_{this->brush};  // TODO possibly make public member
     Alignment alignment_{Alignment::Left};
 };
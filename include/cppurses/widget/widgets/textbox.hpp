@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
 
 namespace cppurses {
 
@@ -24,6 +25,8 @@ class Textbox : public Textbox_base {
 
    protected:
     bool key_press_event(Key key, char symbol) override;
+    // Inserts the whole text at the cursor with a single re-layout.
+    bool paste_event(const std::string& text) override;
     bool mouse_press_event(Mouse_button button,
                            Point global,
                            Point local,
@@ -0,0 +1,298 @@
+#include <cppurses/painter/attribute.hpp>
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/color.hpp>
+#include <cppurses/painter/detail/ansi_paint_engine.hpp>
+#include <cppurses/painter/detail/ncurses_paint_engine.hpp>
+#include <cppurses/painter/glyph.hpp>
+
+#include <ncurses.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace {
+using namespace cppurses;
+
+std::size_t digits(std::size_t n) {
+    std::size_t count{1};
+    while (n >= 10) {
+        n /= 10;
+        ++count;
+    }
+    return count;
+}
+
+// SGR parameter for each Attribute, in Attribute enum order.
+const char* const sgr_codes[8] = {"1", "3", "4", "7", "2", "7", "8", "5"};
+
+std::uint8_t attribute_bits(const Brush& brush) {
+    std::uint8_t bits{0};
+    for (std::int8_t i{0}; i < 8; ++i) {
+        if (brush.has_attribute(static_cast<Attribute>(i))) {
+            bits |= 1 << i;
+        }
+    }
+    return bits;
+}
+
+enum class Motion { Absolute, Forward, Backward, Return, Up, Down, Newline };
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+ANSI_paint_engine::ANSI_paint_engine(int output_fd) : output_fd_{output_fd} {
+    initialize_ncurses();
+    // Let ncurses clear the screen now, it is never drawn to afterwards.
+    ::refresh();
+    cursor_visible_ = false;
+    buffer_.append("\033[?25l");
+    this->write_buffer();
+}
+
+ANSI_paint_engine::~ANSI_paint_engine() {
+    // Reset SGR and palette, show the cursor.
+    buffer_.append("\033[0m\033]104\033\\\033[?25h");
+    this->write_buffer();
+    ::endwin();
+}
+
+void ANSI_paint_engine::set_rgb(Color c,
+                                std::int16_t r,
+                                std::int16_t g,
+                                std::int16_t b) {
+    auto append_hex = [this](std::int16_t value) {
+        const char* const hex = "0123456789abcdef";
+        buffer_.push_back(hex[(value >> 4) & 0xF]);
+        buffer_.push_back(hex[value & 0xF]);
+    };
+    buffer_.append("\033]4;");
+    this->append_number(static_cast<std::size_t>(c));
+    buffer_.append(";rgb:");
+    append_hex(r);
+    buffer_.push_back('/');
+    append_hex(g);
+    buffer_.push_back('/');
+    append_hex(b);
+    buffer_.append("\033\\");
+}
+
+void ANSI_paint_engine::put_glyph(const Glyph& g) {
+    this->put_run(x_, y_, &g, 1);
+}
+
+void ANSI_paint_engine::put_run(std::size_t x,
+                                std::size_t y,
+                                const Glyph* first,
+                                std::size_t length) {
+    if (length == 0) {
+        return;
+    }
+    this->move(x, y);
+    this->move_cursor();
+    this->set_brush(first->brush());
+    for (const Glyph* g{first}; g != first + length; ++g) {
+        buffer_.append(g->c_str());
+    }
+    // Only the last Glyph of a run can be wide, the Paint_buffer ends a run
+    // at each continuation cell.
+    x_ += length - 1 + first[length - 1].width();
+    cursor_x_ = x_;
+    // Terminals differ on where the cursor is after writing the last column.
+    if (cursor_x_ >= width_) {
+        cursor_known_ = false;
+    }
+}
+
+void ANSI_paint_engine::show_cursor(bool show) {
+    if (show == cursor_visible_) {
+        return;
+    }
+    cursor_visible_ = show;
+    buffer_.append(show ? "\033[?25h" : "\033[?25l");
+}
+
+std::size_t ANSI_paint_engine::screen_width() {
+    ::winsize size;  // NOLINT
+    if (::ioctl(output_fd_, TIOCGWINSZ, &size) == 0 && size.ws_col != 0) {
+        width_ = size.ws_col;
+    } else {
+        width_ = COLS;
+    }
+    return width_;
+}
+
+std::size_t ANSI_paint_engine::screen_height() {
+    ::winsize size;  // NOLINT
+    if (::ioctl(output_fd_, TIOCGWINSZ, &size) == 0 && size.ws_row != 0) {
+        return size.ws_row;
+    }
+    return LINES;
+}
+
+void ANSI_paint_engine::touch_all() {
+    cursor_known_ = false;
+    sgr_known_ = false;
+}
+
+void ANSI_paint_engine::move(std::size_t x, std::size_t y) {
+    x_ = x;
+    y_ = y;
+}
+
+void ANSI_paint_engine::refresh() {
+    this->move_cursor();
+    this->write_buffer();
+    // ncurses would otherwise redraw its own, blank, stdscr on the next getch.
+    ::untouchwin(::stdscr);
+}
+
+void ANSI_paint_engine::move_cursor() {
+    if (cursor_known_ && cursor_x_ == x_ && cursor_y_ == y_) {
+        return;
+    }
+    Motion best{Motion::Absolute};
+    std::size_t best_length{4 + digits(y_ + 1) + digits(x_ + 1)};
+    auto consider = [&best, &best_length](Motion m, std::size_t length) {
+        if (length < best_length) {
+            best = m;
+            best_length = length;
+        }
+    };
+    if (cursor_known_) {
+        if (cursor_y_ == y_) {
+            if (x_ > cursor_x_) {
+                consider(Motion::Forward, 3 + digits(x_ - cursor_x_));
+            } else {
+                consider(Motion::Backward, 3 + digits(cursor_x_ - x_));
+            }
+            consider(Motion::Return, x_ == 0 ? 1 : 4 + digits(x_));
+        } else if (cursor_x_ == x_) {
+            if (y_ > cursor_y_) {
+                consider(Motion::Down, 3 + digits(y_ - cursor_y_));
+            } else {
+                consider(Motion::Up, 3 + digits(cursor_y_ - y_));
+            }
+        } else if (x_ == 0 && y_ == cursor_y_ + 1) {
+            consider(Motion::Newline, 2);
+        }
+    }
+    auto csi = [this](std::size_t n, char final) {
+        buffer_.append("\033[");
+        this->append_number(n);
+        buffer_.push_back(final);
+    };
+    switch (best) {
+        case Motion::Absolute:
+            buffer_.append("\033[");
+            this->append_number(y_ + 1);
+            buffer_.push_back(';');
+            this->append_number(x_ + 1);
+            buffer_.push_back('H');
+            break;
+        case Motion::Forward:
+            csi(x_ - cursor_x_, 'C');
+            break;
+        case Motion::Backward:
+            csi(cursor_x_ - x_, 'D');
+            break;
+        case Motion::Return:
+            buffer_.push_back('\r');
+            if (x_ != 0) {
+                csi(x_, 'C');
+            }
+            break;
+        case Motion::Up:
+            csi(cursor_y_ - y_, 'A');
+            break;
+        case Motion::Down:
+            csi(y_ - cursor_y_, 'B');
+            break;
+        case Motion::Newline:
+            buffer_.append("\r\n");
+            break;
+    }
+    cursor_known_ = true;
+    cursor_x_ = x_;
+    cursor_y_ = y_;
+}
+
+// Unset colors are black, as color pair 0 is for the NCurses_paint_engine.
+void ANSI_paint_engine::set_brush(const Brush& brush) {
+    const std::uint8_t attributes{attribute_bits(brush)};
+    const Color foreground{brush.foreground_color()
+                               ? *brush.foreground_color()
+                               : Color::Black};
+    const Color background{brush.background_color()
+                               ? *brush.background_color()
+                               : Color::Black};
+    if (sgr_known_ && attributes == attributes_ &&
+        foreground == foreground_ && background == background_) {
+        return;
+    }
+    buffer_.append("\033[");
+    // Attributes can only be turned off all at once.
+    const bool reset{!sgr_known_ || (attributes_ & ~attributes) != 0};
+    if (reset) {
+        buffer_.append("0;");
+        attributes_ = 0;
+    }
+    for (std::int8_t i{0}; i < 8; ++i) {
+        const std::uint8_t bit = 1 << i;
+        if ((attributes & bit) != 0 && (attributes_ & bit) == 0) {
+            buffer_.append(sgr_codes[i]);
+            buffer_.push_back(';');
+        }
+    }
+    if (reset || foreground != foreground_) {
+        buffer_.append("38;5;");
+        this->append_number(static_cast<std::size_t>(foreground));
+        buffer_.push_back(';');
+    }
+    if (reset || background != background_) {
+        buffer_.append("48;5;");
+        this->append_number(static_cast<std::size_t>(background));
+        buffer_.push_back(';');
+    }
+    buffer_.back() = 'm';
+    sgr_known_ = true;
+    attributes_ = attributes;
+    foreground_ = foreground;
+    background_ = background;
+}
+
+void ANSI_paint_engine::append_number(std::size_t n) {
+    char digits_buffer[20];
+    std::size_t i{0};
+    do {
+        digits_buffer[i++] = '0' + n % 10;
+        n /= 10;
+    } while (n != 0);
+    while (i != 0) {
+        buffer_.push_back(digits_buffer[--i]);
+    }
+}
+
+void ANSI_paint_engine::write_buffer() {
+    std::size_t written{0};
+    while (written < buffer_.size()) {
+        auto result = ::write(output_fd_, buffer_.data() + written,
+                              buffer_.size() - written);
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        written += result;
+    }
+    buffer_.clear();
+}
+
+}  // namespace detail
+}  // namespace cppurses
@@ -24,6 +24,10 @@ std::vector<Attribute> Brush::attributes() const {
     return vec;
 }
 
+bool Brush::has_attribute(Attribute attr) const {
+    return attributes_.test(static_cast<std::int8_t>(attr));
+}
+
 void Brush::set_attr(Attribute attr) {
     attributes_.set(static_cast<std::int8_t>(attr));
 }
@@ -0,0 +1,132 @@
+#include <cppurses/painter/attribute.hpp>
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/color.hpp>
+#include <cppurses/painter/detail/cell.hpp>
+#include <cppurses/painter/detail/char_width.hpp>
+#include <cppurses/painter/detail/grapheme_table.hpp>
+#include <cppurses/painter/glyph.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace {
+using namespace cppurses;
+
+const std::size_t attribute_count{8};
+
+std::uint8_t color_offset(Color c) {
+    return static_cast<std::uint8_t>(static_cast<std::int16_t>(c) -
+                                     static_cast<std::int16_t>(Color::Black));
+}
+
+Color to_color(std::uint8_t offset) {
+    return static_cast<Color>(static_cast<std::int16_t>(Color::Black) +
+                              offset);
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+const std::uint8_t Cell::has_background;
+const std::uint8_t Cell::has_foreground;
+const std::uint8_t Cell::wide;
+const std::uint8_t Cell::continuation;
+
+bool wide_symbol(std::uint32_t symbol) {
+    if ((symbol & 0xFF) == grapheme_id_marker) {
+        return grapheme_table().width(symbol >> 8) == 2;
+    }
+    char bytes[4];
+    std::size_t length{0};
+    for (; length < 4 && (symbol >> (8 * length)) != 0; ++length) {
+        bytes[length] = static_cast<char>((symbol >> (8 * length)) & 0xFF);
+    }
+    return symbol_width(bytes, length) == 2;
+}
+
+Cell to_cell(const Glyph& g) {
+    std::uint32_t symbol{0};
+    for (std::size_t i{0}; i < 4; ++i) {
+        symbol |= static_cast<std::uint32_t>(
+                      static_cast<unsigned char>(g.symbol_[i]))
+                  << (8 * i);
+    }
+    Cell c;
+    set_symbol(c, symbol);
+    set_brush(c, g.brush());
+    return c;
+}
+
+Glyph to_glyph(const Cell& c) {
+    Glyph g;
+    set_symbol(g, c);
+    for (std::size_t i{0}; c.attributes >> i != 0; ++i) {
+        if ((c.attributes & (1 << i)) != 0) {
+            g.brush().add_attributes(static_cast<Attribute>(i));
+        }
+    }
+    if ((c.flags & Cell::has_background) != 0) {
+        g.brush().set_background(to_color(c.colors & 0x0F));
+    }
+    if ((c.flags & Cell::has_foreground) != 0) {
+        g.brush().set_foreground(to_color(c.colors >> 4));
+    }
+    return g;
+}
+
+void set_symbol(Glyph& g, const Cell& c) {
+    // Both hold the same four bytes, interned symbols included.
+    for (std::size_t i{0}; i < 4; ++i) {
+        g.symbol_[i] = static_cast<char>((c.symbol >> (8 * i)) & 0xFF);
+    }
+    g.symbol_[4] = '\0';
+}
+
+void set_brush(Cell& c, const Brush& b) {
+    c.attributes = 0;
+    c.colors = 0;
+    c.flags &= Cell::wide | Cell::continuation;
+    for (std::size_t i{0}; i < attribute_count; ++i) {
+        if (b.has_attribute(static_cast<Attribute>(i))) {
+            c.attributes |= 1 << i;
+        }
+    }
+    if (b.background_color()) {
+        c.colors |= color_offset(*b.background_color());
+        c.flags |= Cell::has_background;
+    }
+    if (b.foreground_color()) {
+        c.colors |= color_offset(*b.foreground_color()) << 4;
+        c.flags |= Cell::has_foreground;
+    }
+}
+
+void Cell_matrix::resize(std::size_t width, std::size_t height) {
+    const Cell blank{to_cell(Glyph{" "})};
+    if (width == width_) {
+        // Rows are contiguous, so only the tail changes.
+        matrix_.resize(width * height, blank);
+        matrix_.shrink_to_fit();
+        height_ = height;
+        return;
+    }
+    std::vector<Cell> resized(width * height, blank);
+    const std::size_t copy_width{std::min(width, width_)};
+    const std::size_t copy_height{std::min(height, height_)};
+    for (std::size_t y{0}; y < copy_height; ++y) {
+        auto first = std::begin(matrix_) + y * width_;
+        std::copy(first, first + copy_width, std::begin(resized) + y * width);
+    }
+    matrix_ = std::move(resized);
+    width_ = width;
+    height_ = height;
+}
+
+}  // namespace detail
+}  // namespace cppurses
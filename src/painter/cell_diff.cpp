@@ -0,0 +1,118 @@
+#include <cppurses/painter/detail/cell.hpp>
+#include <cppurses/painter/detail/cell_diff.hpp>
+
+#include <cstddef>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CPPURSES_CELL_DIFF_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+using cppurses::detail::Cell;
+using cppurses::detail::find_mismatch_scalar;
+
+struct Implementation {
+    std::size_t (*find)(const Cell*, const Cell*, std::size_t);
+    const char* name;
+};
+
+#ifdef CPPURSES_CELL_DIFF_X86
+// Blocks of Cells are xor-ed and or-ed together, only a block with a
+// difference in it is searched one Cell at a time.
+
+__attribute__((target("sse2"))) std::size_t find_mismatch_sse2(
+    const Cell* lhs,
+    const Cell* rhs,
+    std::size_t length) {
+    const std::size_t block{16};
+    std::size_t i{0};
+    for (; i + block <= length; i += block) {
+        __m128i diff{_mm_setzero_si128()};
+        for (std::size_t j{0}; j < block; j += 2) {
+            const __m128i l{_mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(lhs + i + j))};
+            const __m128i r{_mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(rhs + i + j))};
+            diff = _mm_or_si128(diff, _mm_xor_si128(l, r));
+        }
+        const __m128i zero{_mm_cmpeq_epi8(diff, _mm_setzero_si128())};
+        if (_mm_movemask_epi8(zero) != 0xFFFF) {
+            break;
+        }
+    }
+    return i + find_mismatch_scalar(lhs + i, rhs + i, length - i);
+}
+
+__attribute__((target("avx2"))) std::size_t find_mismatch_avx2(
+    const Cell* lhs,
+    const Cell* rhs,
+    std::size_t length) {
+    const std::size_t block{32};
+    std::size_t i{0};
+    for (; i + block <= length; i += block) {
+        __m256i diff{_mm256_setzero_si256()};
+        for (std::size_t j{0}; j < block; j += 4) {
+            const __m256i l{_mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(lhs + i + j))};
+            const __m256i r{_mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(rhs + i + j))};
+            diff = _mm256_or_si256(diff, _mm256_xor_si256(l, r));
+        }
+        if (_mm256_testz_si256(diff, diff) == 0) {
+            break;
+        }
+    }
+    // Mixing dirty upper halves with SSE code is slow, compilers do not
+    // always insert this on their own.
+    _mm256_zeroupper();
+    return i + find_mismatch_scalar(lhs + i, rhs + i, length - i);
+}
+#endif  // CPPURSES_CELL_DIFF_X86
+
+Implementation pick_implementation() {
+#ifdef CPPURSES_CELL_DIFF_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return Implementation{find_mismatch_avx2, "avx2"};
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return Implementation{find_mismatch_sse2, "sse2"};
+    }
+#endif
+    return Implementation{find_mismatch_scalar, "scalar"};
+}
+
+const Implementation& implementation() {
+    static const Implementation picked{pick_implementation()};
+    return picked;
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+std::size_t find_mismatch(const Cell* lhs,
+                          const Cell* rhs,
+                          std::size_t length) {
+    return implementation().find(lhs, rhs, length);
+}
+
+std::size_t find_mismatch_scalar(const Cell* lhs,
+                                 const Cell* rhs,
+                                 std::size_t length) {
+    for (std::size_t i{0}; i < length; ++i) {
+        if (lhs[i] != rhs[i]) {
+            return i;
+        }
+    }
+    return length;
+}
+
+const char* find_mismatch_implementation() {
+    return implementation().name;
+}
+
+}  // namespace detail
+}  // namespace cppurses
@@ -1,12 +1,35 @@
+#include <cppurses/painter/detail/char_width.hpp>
+#include <cppurses/painter/detail/grapheme_table.hpp>
 #include <cppurses/painter/glyph.hpp>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <ostream>
 #include <string>
 
+namespace {
+
+// Grapheme_table id held by an interned symbol.
+std::uint32_t id_of(const std::array<char, 5>& symbol) {
+    std::uint32_t id{0};
+    for (std::size_t i{0}; i < 3; ++i) {
+        id |= static_cast<std::uint32_t>(
+                  static_cast<unsigned char>(symbol[i + 1]))
+              << (8 * i);
+    }
+    return id;
+}
+
+}  // namespace
+
 namespace cppurses {
 
 const char* Glyph::c_str() const {
+    if (this->interned()) {
+        return detail::grapheme_table().symbol(id_of(symbol_)).c_str();
+    }
     return symbol_.data();
 }
 
@@ -14,30 +37,47 @@ std::string Glyph::str() const {
     return std::string(this->c_str());
 }
 
+std::size_t Glyph::lookup_width() const {
+    if (this->interned()) {
+        return detail::grapheme_table().width(id_of(symbol_));
+    }
+    return detail::symbol_width(symbol_.data(), std::strlen(symbol_.data()));
+}
+
 void Glyph::set_symbol(char symbol) {
-    symbol_[0] = symbol;
-    symbol_[1] = '\0';
+    this->set_symbol(&symbol, 1);
 }
 
 void Glyph::set_symbol(const char* symbol) {
-    if (std::strlen(symbol) > 4) {
-        throw Glyph::Length_error(
-            "Glyph::set_symbol(const char*) - Symbol too large for Glyph.");
-    }
-    std::strncpy(symbol_.data(), symbol, 5);
+    this->set_symbol(symbol, std::strlen(symbol));
 }
 
 void Glyph::set_symbol(const std::string& symbol) {
-    if (symbol.size() > 4) {
-        throw Glyph::Length_error(
-            "Glyph::set_symbol(const string&) - Symbol too large for Glyph.");
+    this->set_symbol(symbol.c_str(), std::strlen(symbol.c_str()));
+}
+
+void Glyph::set_symbol(const char* symbol, std::size_t length) {
+    symbol_.fill('\0');
+    const bool marked{length != 0 && static_cast<unsigned char>(symbol[0]) ==
+                                         detail::grapheme_id_marker};
+    if (length <= 4 && !marked) {
+        std::memcpy(symbol_.data(), symbol, length);
+        return;
     }
-    std::strncpy(symbol_.data(), symbol.c_str(), 5);
+    const std::uint32_t id{detail::grapheme_table().intern(symbol, length)};
+    symbol_[0] = static_cast<char>(detail::grapheme_id_marker);
+    for (std::size_t i{0}; i < 3; ++i) {
+        symbol_[i + 1] = static_cast<char>((id >> (8 * i)) & 0xFF);
+    }
+}
+
+bool Glyph::interned() const {
+    return static_cast<unsigned char>(symbol_[0]) ==
+           detail::grapheme_id_marker;
 }
 
 bool operator==(const Glyph& lhs, const Glyph& rhs) {
-    return ((std::strcmp(lhs.c_str(), rhs.c_str()) == 0) &&
-            (lhs.brush() == rhs.brush()));
+    return lhs.symbol_ == rhs.symbol_ && lhs.brush() == rhs.brush();
 }
 
 bool operator!=(const Glyph& lhs, const Glyph& rhs) {
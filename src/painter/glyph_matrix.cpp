@@ -2,48 +2,87 @@
 #include <cppurses/painter/glyph_matrix.hpp>
 #include <cppurses/widget/point.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace cppurses {
 Glyph_matrix::Glyph_matrix(std::size_t width, std::size_t height)
-    : matrix_{height, std::vector<Glyph>(width, Glyph(" "))} {}
+    : matrix_(width * height, Glyph(" ")), width_{width}, height_{height} {}
 
 void Glyph_matrix::resize(std::size_t width, std::size_t height) {
-    matrix_.resize(height);
-    matrix_.shrink_to_fit();
-    for (auto& row : matrix_) {
-        row.resize(width, Glyph(" "));
-        row.shrink_to_fit();
+    if (width == width_) {
+        // Rows are contiguous, so only the tail changes.
+        matrix_.resize(width * height, Glyph(" "));
+        matrix_.shrink_to_fit();
+        height_ = height;
+        return;
     }
+    std::vector<Glyph> resized(width * height, Glyph(" "));
+    const std::size_t copy_width{std::min(width, width_)};
+    const std::size_t copy_height{std::min(height, height_)};
+    for (std::size_t y{0}; y < copy_height; ++y) {
+        auto first = std::begin(matrix_) + y * width_;
+        std::move(first, first + copy_width, std::begin(resized) + y * width);
+    }
+    matrix_ = std::move(resized);
+    width_ = width;
+    height_ = height;
 }
 
 void Glyph_matrix::clear() {
     matrix_.clear();
+    width_ = 0;
+    height_ = 0;
 }
 
 std::size_t Glyph_matrix::width() const {
-    return matrix_.empty() ? 0 : matrix_.at(0).size();
+    return width_;
 }
 
 std::size_t Glyph_matrix::height() const {
-    return matrix_.size();
+    return height_;
 }
 
 Glyph& Glyph_matrix::operator()(std::size_t x, std::size_t y) {
-    return matrix_[y][x];
+    return matrix_[y * width_ + x];
 }
 
 const Glyph& Glyph_matrix::operator()(std::size_t x, std::size_t y) const {
-    return matrix_[y][x];
+    return matrix_[y * width_ + x];
 }
 
 Glyph& Glyph_matrix::at(std::size_t x, std::size_t y) {
-    return matrix_.at(y).at(x);
+    if (x >= width_ || y >= height_) {
+        throw std::out_of_range("Glyph_matrix::at() - Index out of range.");
+    }
+    return (*this)(x, y);
 }
 
 const Glyph& Glyph_matrix::at(std::size_t x, std::size_t y) const {
-    return matrix_.at(y).at(x);
+    if (x >= width_ || y >= height_) {
+        throw std::out_of_range("Glyph_matrix::at() - Index out of range.");
+    }
+    return (*this)(x, y);
+}
+
+Glyph* Glyph_matrix::row(std::size_t y) {
+    return matrix_.data() + y * width_;
+}
+
+const Glyph* Glyph_matrix::row(std::size_t y) const {
+    return matrix_.data() + y * width_;
+}
+
+Glyph* Glyph_matrix::data() {
+    return matrix_.data();
+}
+
+const Glyph* Glyph_matrix::data() const {
+    return matrix_.data();
 }
 
 }  // namespace cppurses
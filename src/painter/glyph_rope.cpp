@@ -0,0 +1,519 @@
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/detail/cell.hpp>
+#include <cppurses/painter/detail/glyph_rope.hpp>
+#include <cppurses/painter/detail/grapheme_table.hpp>
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+// Marks a symbol that is not a single UTF-8 sequence, such as an empty one.
+// It is followed by a length byte and the symbol. 0xFF never starts UTF-8.
+const unsigned char escape{0xFF};
+
+// Marks a symbol kept in the Grapheme_table, followed by the three bytes of
+// its id, lowest first. 0xFE never starts UTF-8 either.
+const unsigned char interned{0xFE};
+
+// Bytes in the UTF-8 sequence starting with lead, zero if lead can't start
+// one.
+std::size_t sequence_length(unsigned char lead) {
+    if (lead < 0x80) {
+        return 1;
+    }
+    if (lead >= 0xC0 && lead < 0xE0) {
+        return 2;
+    }
+    if (lead >= 0xE0 && lead < 0xF0) {
+        return 3;
+    }
+    if (lead >= 0xF0 && lead < 0xF8) {
+        return 4;
+    }
+    return 0;
+}
+
+// Bytes the stored symbol starting at bytes takes up.
+std::size_t stored_length(const char* bytes) {
+    const auto lead = static_cast<unsigned char>(bytes[0]);
+    if (lead == escape) {
+        return 2 + static_cast<unsigned char>(bytes[1]);
+    }
+    if (lead == interned) {
+        return 4;
+    }
+    return sequence_length(lead);
+}
+
+// Symbol stored at bytes packed as a Cell symbol, first byte lowest.
+std::uint32_t packed_symbol(const char* bytes) {
+    const auto lead = static_cast<unsigned char>(bytes[0]);
+    std::size_t length{sequence_length(lead)};
+    if (lead == interned) {
+        std::uint32_t symbol{cppurses::detail::grapheme_id_marker};
+        for (std::size_t i{1}; i < 4; ++i) {
+            const auto byte = static_cast<unsigned char>(bytes[i]);
+            symbol |= static_cast<std::uint32_t>(byte) << (8 * i);
+        }
+        return symbol;
+    }
+    if (lead == escape) {
+        length = static_cast<unsigned char>(bytes[1]);
+        bytes += 2;
+    }
+    std::uint32_t symbol{0};
+    for (std::size_t i{0}; i < length; ++i) {
+        const auto byte = static_cast<unsigned char>(bytes[i]);
+        symbol |= static_cast<std::uint32_t>(byte) << (8 * i);
+    }
+    return symbol;
+}
+
+cppurses::Glyph make_glyph(const char* bytes, const cppurses::Brush& brush) {
+    cppurses::detail::Cell cell;
+    cell.symbol = packed_symbol(bytes);
+    cppurses::Glyph glyph;
+    glyph.set_brush(brush);
+    cppurses::detail::set_symbol(glyph, cell);
+    return glyph;
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+const std::size_t Glyph_rope::max_leaf_size;
+
+// - - - - - - - - - - - - - - - - Iterator - - - - - - - - - - - - - - - - - -
+
+Glyph_rope::Iterator::Iterator(const Node* root, std::size_t index)
+    : root_{root}, index_{index} {
+    if (root_ != nullptr && index_ < root_->size) {
+        this->find_leaf();
+    }
+}
+
+void Glyph_rope::Iterator::find_leaf() {
+    const Node* node{root_};
+    std::size_t offset{index_};
+    while (node->left != nullptr) {
+        if (offset < node->left->size) {
+            node = node->left.get();
+        } else {
+            offset -= node->left->size;
+            node = node->right.get();
+        }
+    }
+    leaf_ = node;
+    leaf_end_ = index_ - offset + node->size;
+    byte_ = Glyph_rope::byte_offset(*node, offset);
+    run_ = 0;
+    while (offset >= node->runs[run_].length) {
+        offset -= node->runs[run_].length;
+        ++run_;
+    }
+    run_left_ = node->runs[run_].length - offset;
+}
+
+Glyph Glyph_rope::Iterator::operator*() const {
+    return make_glyph(&leaf_->symbols[byte_], leaf_->runs[run_].brush);
+}
+
+Glyph_rope::Iterator& Glyph_rope::Iterator::operator++() {
+    ++index_;
+    if (index_ >= leaf_end_) {
+        if (index_ < root_->size) {
+            this->find_leaf();
+        } else {
+            leaf_ = nullptr;
+        }
+        return *this;
+    }
+    byte_ += stored_length(&leaf_->symbols[byte_]);
+    if (--run_left_ == 0) {
+        ++run_;
+        run_left_ = leaf_->runs[run_].length;
+    }
+    return *this;
+}
+
+Glyph_rope::Iterator Glyph_rope::Iterator::operator++(int) {
+    Iterator previous{*this};
+    ++(*this);
+    return previous;
+}
+
+bool Glyph_rope::Iterator::symbol_is(char symbol) const {
+    // Continuation and escape bytes are never ASCII, so an ASCII byte here
+    // is a whole symbol.
+    return leaf_->symbols[byte_] == symbol;
+}
+
+std::size_t Glyph_rope::Iterator::width() const {
+    // Nothing below U+1100, the first wide code point, is wide.
+    if (static_cast<unsigned char>(leaf_->symbols[byte_]) < 0xE1) {
+        return 1;
+    }
+    return wide_symbol(packed_symbol(&leaf_->symbols[byte_])) ? 2 : 1;
+}
+
+// - - - - - - - - - - - - - - - - Glyph_rope - - - - - - - - - - - - - - - - -
+
+Glyph_rope::Glyph_rope(const Glyph_string& glyphs)
+    : root_{build(glyphs, 0, glyphs.size())} {}
+
+std::size_t Glyph_rope::size() const {
+    return size(root_);
+}
+
+Glyph Glyph_rope::at(std::size_t index) const {
+    if (index >= this->size()) {
+        throw std::out_of_range{"Glyph_rope::at(): index out of range."};
+    }
+    return *this->iterator_at(index);
+}
+
+Glyph_rope::Iterator Glyph_rope::iterator_at(std::size_t index) const {
+    return Iterator{root_.get(), std::min(index, this->size())};
+}
+
+void Glyph_rope::insert(std::size_t index, const Glyph_string& glyphs) {
+    if (glyphs.empty()) {
+        return;
+    }
+    root_ = replace(root_, std::min(index, this->size()), 0, glyphs);
+}
+
+void Glyph_rope::append(const Glyph_string& glyphs) {
+    this->insert(this->size(), glyphs);
+}
+
+void Glyph_rope::erase(std::size_t index, std::size_t length) {
+    if (index >= this->size()) {
+        return;
+    }
+    length = std::min(length, this->size() - index);
+    root_ = replace(root_, index, length, Glyph_string{});
+}
+
+Glyph_string Glyph_rope::substr(std::size_t index, std::size_t length) const {
+    index = std::min(index, this->size());
+    length = std::min(length, this->size() - index);
+    return Glyph_string(this->iterator_at(index),
+                        this->iterator_at(index + length));
+}
+
+std::size_t Glyph_rope::copy(std::size_t index,
+                             std::size_t length,
+                             Cell* out) const {
+    // Brushes are packed once per Run, symbols straight from the leaf.
+    std::size_t wide{0};
+    const Run* run{nullptr};
+    Cell brush;
+    auto glyph = this->iterator_at(index);
+    for (std::size_t i{0}; i < length; ++i, ++glyph) {
+        const Node& leaf{*glyph.leaf_};
+        if (&leaf.runs[glyph.run_] != run) {
+            run = &leaf.runs[glyph.run_];
+            set_brush(brush, run->brush);
+        }
+        out[i] = brush;
+        set_symbol(out[i], packed_symbol(&leaf.symbols[glyph.byte_]));
+        wide += is_wide(out[i]) ? 1 : 0;
+    }
+    return wide;
+}
+
+std::size_t Glyph_rope::node_count() const {
+    return node_count(root_);
+}
+
+std::size_t Glyph_rope::height() const {
+    return height(root_);
+}
+
+std::size_t Glyph_rope::size(const Node_ptr& node) {
+    return node == nullptr ? 0 : node->size;
+}
+
+std::size_t Glyph_rope::height(const Node_ptr& node) {
+    return node == nullptr ? 0 : node->height;
+}
+
+Glyph_rope::Node_ptr Glyph_rope::make_branch(Node_ptr left, Node_ptr right) {
+    auto branch = std::make_shared<Node>();
+    branch->size = left->size + right->size;
+    branch->height = std::max(left->height, right->height) + 1;
+    branch->left = std::move(left);
+    branch->right = std::move(right);
+    return branch;
+}
+
+void Glyph_rope::append_to_leaf(Node& leaf,
+                                const Node& from,
+                                std::size_t first,
+                                std::size_t last) {
+    if (first == last) {
+        return;
+    }
+    const std::size_t first_byte{byte_offset(from, first)};
+    const std::size_t last_byte{byte_offset(from, last)};
+    leaf.symbols.append(from.symbols, first_byte, last_byte - first_byte);
+    leaf.single_byte =
+        leaf.single_byte && (last_byte - first_byte == last - first);
+    leaf.size += last - first;
+
+    std::size_t run_start{0};
+    for (const Run& run : from.runs) {
+        const std::size_t run_end{run_start + run.length};
+        const std::size_t begin{std::max(run_start, first)};
+        const std::size_t end{std::min(run_end, last)};
+        if (begin < end) {
+            if (!leaf.runs.empty() && leaf.runs.back().brush == run.brush) {
+                leaf.runs.back().length += end - begin;
+            } else {
+                leaf.runs.push_back(Run{end - begin, run.brush});
+            }
+        }
+        if (run_end >= last) {
+            break;
+        }
+        run_start = run_end;
+    }
+}
+
+void Glyph_rope::append_to_leaf(Node& leaf, const Glyph& glyph) {
+    const char* symbol{glyph.c_str()};
+    const std::size_t length{std::strlen(symbol)};
+    if (length > 4 || static_cast<unsigned char>(symbol[0]) == escape) {
+        // Only interned symbols are this long or start with 0xFF.
+        const std::uint32_t id{to_cell(glyph).symbol >> 8};
+        leaf.symbols.push_back(static_cast<char>(interned));
+        for (std::size_t i{0}; i < 3; ++i) {
+            leaf.symbols.push_back(static_cast<char>((id >> (8 * i)) & 0xFF));
+        }
+        leaf.single_byte = false;
+    } else if (length != 0 &&
+        sequence_length(static_cast<unsigned char>(symbol[0])) == length) {
+        leaf.symbols.append(symbol, length);
+        leaf.single_byte = leaf.single_byte && length == 1;
+    } else {
+        leaf.symbols.push_back(static_cast<char>(escape));
+        leaf.symbols.push_back(static_cast<char>(length));
+        leaf.symbols.append(symbol, length);
+        leaf.single_byte = false;
+    }
+    ++leaf.size;
+    if (!leaf.runs.empty() && leaf.runs.back().brush == glyph.brush()) {
+        ++leaf.runs.back().length;
+    } else {
+        leaf.runs.push_back(Run{1, glyph.brush()});
+    }
+}
+
+std::size_t Glyph_rope::byte_offset(const Node& leaf, std::size_t index) {
+    if (leaf.single_byte) {
+        return index;
+    }
+    std::size_t byte{0};
+    for (std::size_t i{0}; i < index; ++i) {
+        byte += stored_length(&leaf.symbols[byte]);
+    }
+    return byte;
+}
+
+// Full leaves, with the leaf count split evenly between the two sides of
+// each branch, so the tree is balanced.
+Glyph_rope::Node_ptr Glyph_rope::build(const Glyph_string& glyphs,
+                                       std::size_t first,
+                                       std::size_t last) {
+    if (first == last) {
+        return nullptr;
+    }
+    const std::size_t leaves{(last - first + max_leaf_size - 1) /
+                             max_leaf_size};
+    if (leaves == 1) {
+        auto leaf = std::make_shared<Node>();
+        leaf->symbols.reserve(last - first);
+        for (std::size_t i{first}; i < last; ++i) {
+            append_to_leaf(*leaf, glyphs[i]);
+        }
+        return leaf;
+    }
+    const std::size_t middle{first + (leaves / 2) * max_leaf_size};
+    return make_branch(build(glyphs, first, middle),
+                       build(glyphs, middle, last));
+}
+
+// Concatenation of two AVL trees, after Blelloch, Ferizovic and Sun, "Just
+// Join for Parallel Ordered Sets". Costs O(difference in height). Adjacent
+// leaves that fit in one are merged, so edits don't fragment the leaves.
+Glyph_rope::Node_ptr Glyph_rope::join(Node_ptr left, Node_ptr right) {
+    if (left == nullptr) {
+        return right;
+    }
+    if (right == nullptr) {
+        return left;
+    }
+    if (left->height == 0 && right->height == 0 &&
+        left->size + right->size <= max_leaf_size) {
+        auto leaf = std::make_shared<Node>(*left);
+        append_to_leaf(*leaf, *right, 0, right->size);
+        return leaf;
+    }
+    if (left->height > right->height + 1) {
+        return join_right(left, right);
+    }
+    if (right->height > left->height + 1) {
+        return join_left(left, right);
+    }
+    return make_branch(std::move(left), std::move(right));
+}
+
+Glyph_rope::Node_ptr Glyph_rope::join_right(const Node_ptr& left,
+                                            const Node_ptr& right) {
+    const Node_ptr& outer{left->left};
+    const Node_ptr& inner{left->right};
+    if (inner->height <= right->height + 1) {
+        Node_ptr joined{join(inner, right)};
+        if (joined->height <= outer->height + 1) {
+            return make_branch(outer, std::move(joined));
+        }
+        return rotate_left(make_branch(outer, rotate_right(joined)));
+    }
+    Node_ptr joined{join_right(inner, right)};
+    if (joined->height <= outer->height + 1) {
+        return make_branch(outer, std::move(joined));
+    }
+    return rotate_left(make_branch(outer, std::move(joined)));
+}
+
+Glyph_rope::Node_ptr Glyph_rope::join_left(const Node_ptr& left,
+                                           const Node_ptr& right) {
+    const Node_ptr& inner{right->left};
+    const Node_ptr& outer{right->right};
+    if (inner->height <= left->height + 1) {
+        Node_ptr joined{join(left, inner)};
+        if (joined->height <= outer->height + 1) {
+            return make_branch(std::move(joined), outer);
+        }
+        return rotate_right(make_branch(rotate_left(joined), outer));
+    }
+    Node_ptr joined{join_left(left, inner)};
+    if (joined->height <= outer->height + 1) {
+        return make_branch(std::move(joined), outer);
+    }
+    return rotate_right(make_branch(std::move(joined), outer));
+}
+
+// (x, (y, z)) -> ((x, y), z)
+Glyph_rope::Node_ptr Glyph_rope::rotate_left(const Node_ptr& node) {
+    return make_branch(make_branch(node->left, node->right->left),
+                       node->right->right);
+}
+
+// ((x, y), z) -> (x, (y, z))
+Glyph_rope::Node_ptr Glyph_rope::rotate_right(const Node_ptr& node) {
+    return make_branch(node->left->left,
+                       make_branch(node->left->right, node->right));
+}
+
+void Glyph_rope::split(const Node_ptr& node,
+                       std::size_t index,
+                       Node_ptr& left,
+                       Node_ptr& right) {
+    if (index == 0) {
+        left = nullptr;
+        right = node;
+        return;
+    }
+    if (index >= size(node)) {
+        left = node;
+        right = nullptr;
+        return;
+    }
+    if (node->height == 0) {
+        auto first = std::make_shared<Node>();
+        append_to_leaf(*first, *node, 0, index);
+        auto second = std::make_shared<Node>();
+        append_to_leaf(*second, *node, index, node->size);
+        left = std::move(first);
+        right = std::move(second);
+        return;
+    }
+    Node_ptr inner;
+    if (index <= node->left->size) {
+        split(node->left, index, left, inner);
+        right = join(std::move(inner), node->right);
+    } else {
+        split(node->right, index - node->left->size, inner, right);
+        left = join(node->left, std::move(inner));
+    }
+}
+
+// Only the paths to either end of the replaced range are copied, subtrees
+// entirely within it are dropped.
+Glyph_rope::Node_ptr Glyph_rope::replace(const Node_ptr& node,
+                                         std::size_t index,
+                                         std::size_t length,
+                                         const Glyph_string& glyphs) {
+    if (index == 0 && length >= size(node)) {
+        return build(glyphs, 0, glyphs.size());
+    }
+    if (node->height == 0) {
+        // Small edits overflow into two half full leaves.
+        if (glyphs.size() <= max_leaf_size) {
+            auto leaf = std::make_shared<Node>();
+            append_to_leaf(*leaf, *node, 0, index);
+            for (const Glyph& glyph : glyphs) {
+                append_to_leaf(*leaf, glyph);
+            }
+            append_to_leaf(*leaf, *node, index + length, node->size);
+            if (leaf->size <= max_leaf_size) {
+                return leaf;
+            }
+            Node_ptr first;
+            Node_ptr second;
+            split(leaf, leaf->size / 2, first, second);
+            return make_branch(std::move(first), std::move(second));
+        }
+        Node_ptr prefix;
+        Node_ptr rest;
+        split(node, index, prefix, rest);
+        Node_ptr removed;
+        Node_ptr suffix;
+        split(rest, length, removed, suffix);
+        return join(join(std::move(prefix), build(glyphs, 0, glyphs.size())),
+                    std::move(suffix));
+    }
+    const std::size_t left_size{node->left->size};
+    if (index >= left_size) {
+        return join(node->left,
+                    replace(node->right, index - left_size, length, glyphs));
+    }
+    if (index + length <= left_size) {
+        return join(replace(node->left, index, length, glyphs), node->right);
+    }
+    return join(replace(node->left, index, left_size - index, glyphs),
+                replace(node->right, 0, index + length - left_size,
+                        Glyph_string{}));
+}
+
+std::size_t Glyph_rope::node_count(const Node_ptr& node) {
+    if (node == nullptr) {
+        return 0;
+    }
+    return 1 + node_count(node->left) + node_count(node->right);
+}
+
+}  // namespace detail
+}  // namespace cppurses
@@ -1,11 +1,34 @@
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/detail/char_width.hpp>
+#include <cppurses/painter/detail/utf8.hpp>
 #include <cppurses/painter/glyph.hpp>
 #include <cppurses/painter/glyph_string.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <ostream>
 #include <string>
 
+namespace {
+
+const char replacement_character[] = "\xEF\xBF\xBD";
+
+// True if none of the eight bytes at bytes have the high bit set.
+bool ascii_block(const char* bytes) {
+    std::uint64_t block;
+    std::memcpy(&block, bytes, sizeof(block));
+    return (block & 0x8080808080808080) == 0;
+}
+
+bool is_control(unsigned char byte) {
+    return byte < 0x20 || byte == 0x7F;
+}
+
+}  // namespace
+
 namespace cppurses {
 
 Glyph_string::operator std::string() const {  // NOLINT
@@ -34,6 +57,57 @@ Glyph_string Glyph_string::operator+(const Glyph_string& gs) const {
     return result;
 }
 
+// Glyphs are written straight into the vector, ASCII is checked for eight
+// bytes at a time and skips the decoder.
+void Glyph_string::append_utf8(const char* symbols,
+                               std::size_t length,
+                               const Brush& brush) {
+    // Each code point starts with a byte that is not a continuation byte.
+    std::size_t code_points{0};
+    for (std::size_t i{0}; i < length; ++i) {
+        code_points += (static_cast<unsigned char>(symbols[i]) & 0xC0) != 0x80;
+    }
+    this->reserve(this->size() + code_points);
+    Glyph prototype;
+    prototype.set_brush(brush);
+    std::size_t i{0};
+    while (i < length) {
+        // Nothing can be added to the last byte if the byte after is ASCII.
+        if (i + 8 <= length && ascii_block(symbols + i) &&
+            (i + 8 == length ||
+             static_cast<unsigned char>(symbols[i + 8]) < 0x80)) {
+            for (const std::size_t end{i + 8}; i < end; ++i) {
+                this->push_back(prototype);
+                this->back().set_symbol(symbols + i, 1);
+            }
+            continue;
+        }
+        this->push_back(prototype);
+        char32_t code;
+        std::size_t end{i + detail::decode_utf8(symbols + i, length - i, code)};
+        if (code == detail::invalid_code_point) {
+            this->back().set_symbol(replacement_character, 3);
+            i = end;
+            continue;
+        }
+        // ASCII is never added to a symbol, even after a joiner.
+        bool after_joiner{code == U'\u200D'};
+        while (end < length && !is_control(symbols[i]) &&
+               static_cast<unsigned char>(symbols[end]) >= 0x80) {
+            const std::size_t size{
+                detail::decode_utf8(symbols + end, length - end, code)};
+            if (code == detail::invalid_code_point ||
+                (detail::char_width(code) != 0 && !after_joiner)) {
+                break;
+            }
+            after_joiner = code == U'\u200D';
+            end += size;
+        }
+        this->back().set_symbol(symbols + i, end - i);
+        i = end;
+    }
+}
+
 void Glyph_string::remove_attribute(Attribute attr) {
     for (Glyph& glyph : *this) {
         glyph.brush().remove_attribute(attr);
@@ -0,0 +1,53 @@
+#include <cppurses/painter/detail/char_width.hpp>
+#include <cppurses/painter/detail/grapheme_table.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace cppurses {
+namespace detail {
+
+const std::uint32_t Grapheme_table::max_size;
+
+std::uint32_t Grapheme_table::intern(const char* symbol, std::size_t length) {
+    std::string key(symbol, length);
+    std::lock_guard<std::mutex> lock{mtx_};
+    auto found = ids_.find(key);
+    if (found != std::end(ids_)) {
+        return found->second;
+    }
+    if (entries_.size() == max_size) {
+        throw std::length_error("Grapheme_table::intern - Table is full.");
+    }
+    const auto id = static_cast<std::uint32_t>(entries_.size());
+    entries_.push_back(Entry{key, symbol_width(symbol, length)});
+    ids_.emplace(std::move(key), id);
+    return id;
+}
+
+const std::string& Grapheme_table::symbol(std::uint32_t id) const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return entries_.at(id).symbol;
+}
+
+std::size_t Grapheme_table::width(std::uint32_t id) const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return entries_.at(id).width;
+}
+
+std::size_t Grapheme_table::size() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return entries_.size();
+}
+
+Grapheme_table& grapheme_table() {
+    static Grapheme_table table;
+    return table;
+}
+
+}  // namespace detail
+}  // namespace cppurses
@@ -0,0 +1,87 @@
+#include <cppurses/painter/color.hpp>
+#include <cppurses/painter/detail/headless_paint_engine.hpp>
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/widget/point.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace cppurses {
+namespace detail {
+
+Headless_paint_engine::Headless_paint_engine(std::size_t width,
+                                             std::size_t height)
+    : screen_{width, height},
+      width_{width},
+      height_{height} {}
+
+void Headless_paint_engine::set_rgb(Color c,
+                                    std::int16_t r,
+                                    std::int16_t g,
+                                    std::int16_t b) {}
+
+void Headless_paint_engine::put_glyph(const Glyph& g) {
+    this->put_run(cursor_.x, cursor_.y, &g, 1);
+}
+
+void Headless_paint_engine::put_run(std::size_t x,
+                                    std::size_t y,
+                                    const Glyph* first,
+                                    std::size_t length) {
+    if (length == 0 || y >= screen_.height() || x >= screen_.width()) {
+        return;
+    }
+    const std::size_t count{std::min(length, screen_.width() - x)};
+    std::copy(first, first + count, screen_.row(y) + x);
+    std::size_t end{x + length};
+    if (first[length - 1].width() == 2) {
+        if (end < screen_.width()) {
+            screen_(end, y) = Glyph{"", first[length - 1].brush()};
+        }
+        ++end;
+    }
+    glyphs_written_ += length;
+    cursor_ = Point{end, y};
+}
+
+void Headless_paint_engine::show_cursor(bool show) {
+    cursor_visible_ = show;
+}
+
+std::size_t Headless_paint_engine::screen_width() {
+    if (screen_.width() != width_) {
+        screen_.resize(width_, screen_.height());
+    }
+    return width_;
+}
+
+std::size_t Headless_paint_engine::screen_height() {
+    if (screen_.height() != height_) {
+        screen_.resize(screen_.width(), height_);
+    }
+    return height_;
+}
+
+void Headless_paint_engine::touch_all() {}
+
+void Headless_paint_engine::move(std::size_t x, std::size_t y) {
+    cursor_ = Point{x, y};
+}
+
+void Headless_paint_engine::refresh() {
+    ++refresh_count_;
+}
+
+void Headless_paint_engine::resize(std::size_t width, std::size_t height) {
+    width_ = width;
+    height_ = height;
+}
+
+void Headless_paint_engine::reset_counters() {
+    glyphs_written_ = 0;
+    refresh_count_ = 0;
+}
+
+}  // namespace detail
+}  // namespace cppurses
@@ -3,7 +3,6 @@
 #include <cppurses/painter/color.hpp>
 #include <cppurses/painter/detail/ncurses_paint_engine.hpp>
 #include <cppurses/painter/glyph.hpp>
-#include <cppurses/painter/paint_buffer.hpp>
 
 #include <ncurses.h>
 #include <optional/optional.hpp>
@@ -74,18 +73,23 @@ void initialize_color_pairs() {
 namespace cppurses {
 namespace detail {
 
-NCurses_paint_engine::NCurses_paint_engine(const Paint_buffer& buffer)
-    : buffer_{buffer} {
+void initialize_ncurses() {
     setenv("TERM", "xterm-256color", 1);
     ::setlocale(LC_ALL, "en_US.UTF-8");
     ::initscr();
     ::noecho();
     ::keypad(::stdscr, true);
+    // The Event_loop polls stdin, getch() must never block.
+    ::nodelay(::stdscr, true);
     ::mousemask(ALL_MOUSE_EVENTS, nullptr);
     ::mouseinterval(0);
+    ::set_escdelay(1);
+}
+
+NCurses_paint_engine::NCurses_paint_engine() {
+    initialize_ncurses();
     ::start_color();
     ::assume_default_colors(240, 240);  // Sets color pair 0 to black/black
-    ::set_escdelay(1);
     initialize_color_pairs();
     this->hide_cursor();
 }
@@ -95,22 +99,26 @@ NCurses_paint_engine::~NCurses_paint_engine() {
 }
 
 void NCurses_paint_engine::put_glyph(const Glyph& g) {
-    for (const Attribute& attr : g.brush().attributes()) {
-        this->set_attribute(attr);
-    }
-    if (g.brush().background_color()) {
-        this->set_background_color(*g.brush().background_color());
-    }
-    if (g.brush().foreground_color()) {
-        this->set_foreground_color(*g.brush().foreground_color());
-    }
+    this->set_brush(g.brush());
     this->put_string(g.c_str());
     this->clear_attributes();
 }
 
-void NCurses_paint_engine::put(std::size_t x, std::size_t y, const Glyph& g) {
+void NCurses_paint_engine::put_run(std::size_t x,
+                                   std::size_t y,
+                                   const Glyph* first,
+                                   std::size_t length) {
+    if (length == 0) {
+        return;
+    }
+    run_.clear();
+    for (const Glyph* g{first}; g != first + length; ++g) {
+        run_.append(g->c_str());
+    }
     this->move(x, y);
-    this->put_glyph(g);
+    this->set_brush(first->brush());
+    this->put_string(run_);
+    this->clear_attributes();
 }
 
 void NCurses_paint_engine::touch_all() {
@@ -124,9 +132,6 @@ void NCurses_paint_engine::show_cursor(bool show) {
         ::curs_set(0);
     }
 }
-void NCurses_paint_engine::hide_cursor(bool hide) {
-    this->show_cursor(!hide);
-}
 
 std::size_t NCurses_paint_engine::screen_width() {
     int x{0}, y{0};
@@ -167,6 +172,8 @@ void NCurses_paint_engine::put_string(const std::string& s) {
 
 void NCurses_paint_engine::clear_attributes() {
     wattrset(::stdscr, A_NORMAL);
+    foreground_ = Color::Black;
+    background_ = Color::Black;
 }
 
 void NCurses_paint_engine::set_attribute(Attribute attr) {
@@ -174,29 +181,41 @@ void NCurses_paint_engine::set_attribute(Attribute attr) {
 }
 
 void NCurses_paint_engine::set_background_color(Color c) {
-    ::color_set(find_pair(this->current_foreground(), c), nullptr);
+    background_ = c;
+    ::color_set(find_pair(foreground_, background_), nullptr);
 }
 
 void NCurses_paint_engine::set_foreground_color(Color c) {
-    ::color_set(find_pair(c, this->current_background()), nullptr);
+    foreground_ = c;
+    ::color_set(find_pair(foreground_, background_), nullptr);
 }
 
 void NCurses_paint_engine::refresh() {
     ::wrefresh(::stdscr);
 }
 
-Color NCurses_paint_engine::current_background() {
-    int y{0};
-    int x{0};
-    getyx(::stdscr, y, x);
-    return *buffer_.at(x, y).brush().background_color();
-}
-
-Color NCurses_paint_engine::current_foreground() {
-    int y{0};
-    int x{0};
-    getyx(::stdscr, y, x);
-    return *buffer_.at(x, y).brush().foreground_color();
+void NCurses_paint_engine::set_brush(const Brush& brush) {
+    std::uint32_t attributes{A_NORMAL};
+    for (std::int8_t i{0}; i < 8; ++i) {
+        const auto attr = static_cast<Attribute>(i);
+        if (brush.has_attribute(attr)) {
+            attributes |= attr_to_int(attr);
+        }
+    }
+    if (attributes != A_NORMAL) {
+        ::wattron(::stdscr, attributes);
+    }
+    const auto& background = brush.background_color();
+    const auto& foreground = brush.foreground_color();
+    if (background && foreground) {
+        foreground_ = *foreground;
+        background_ = *background;
+        ::color_set(find_pair(foreground_, background_), nullptr);
+    } else if (background) {
+        this->set_background_color(*background);
+    } else if (foreground) {
+        this->set_foreground_color(*foreground);
+    }
 }
 
 }  // namespace detail
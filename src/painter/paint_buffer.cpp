@@ -1,16 +1,56 @@
+#include <cppurses/painter/detail/cell.hpp>
+#include <cppurses/painter/detail/cell_diff.hpp>
+#include <cppurses/painter/detail/ncurses_paint_engine.hpp>
+#include <cppurses/painter/detail/paint_engine.hpp>
 #include <cppurses/painter/glyph.hpp>
-#include <cppurses/painter/glyph_matrix.hpp>
 #include <cppurses/painter/paint_buffer.hpp>
 #include <cppurses/painter/palette.hpp>
 #include <cppurses/system/focus.hpp>
 #include <cppurses/widget/border.hpp>
 #include <cppurses/widget/widget.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+using namespace cppurses;
+
+// Terminals show a wide symbol with one of its halves painted over as a
+// space, so the staged row is made to match. Cells in [first, last) and the
+// one on either side are checked, the range grows to cover any that change.
+void pair_wide_cells(detail::Cell* row,
+                     std::size_t width,
+                     std::size_t& first,
+                     std::size_t& last) {
+    const std::size_t begin{first == 0 ? 0 : first - 1};
+    const std::size_t end{std::min(last + 1, width)};
+    for (std::size_t x{begin}; x < end; ++x) {
+        const bool lost_right_half{
+            detail::is_wide(row[x]) &&
+            (x + 1 == width || !detail::is_continuation(row[x + 1]))};
+        const bool lost_left_half{detail::is_continuation(row[x]) &&
+                                  (x == 0 || !detail::is_wide(row[x - 1]))};
+        if (lost_right_half || lost_left_half) {
+            detail::blank(row[x]);
+            first = std::min(first, x);
+            last = std::max(last, x + 1);
+        }
+    }
+}
+
+}  // namespace
 
 namespace cppurses {
 
-Paint_buffer::Paint_buffer() {
+Paint_buffer::Paint_buffer()
+    : Paint_buffer{std::make_unique<detail::NCurses_paint_engine>()} {}
+
+Paint_buffer::Paint_buffer(std::unique_ptr<detail::Paint_engine> engine)
+    : engine_{std::move(engine)} {
     this->update_width();
     this->update_height();
 }
@@ -19,74 +59,204 @@ void Paint_buffer::stage(std::size_t x, std::size_t y, const Glyph& glyph) {
     if (y >= staging_area_.height() || x >= staging_area_.width()) {
         return;
     }
-    if (staging_area_(x, y) != glyph) {
-        staging_area_(x, y) = glyph;
+    detail::Cell cell{detail::to_cell(glyph)};
+    if (detail::is_wide(cell)) {
+        this->stage_wide(x, y, cell);
+        return;
+    }
+    if (staging_area_(x, y) != cell) {
+        staging_area_(x, y) = cell;
+        this->mark_dirty(x, y);
     }
 }
 
+void Paint_buffer::stage_wide(std::size_t x,
+                              std::size_t y,
+                              detail::Cell cell) {
+    detail::Cell continuation{detail::continuation_of(cell)};
+    if (x + 1 == staging_area_.width()) {
+        // Half a wide symbol can't be shown.
+        detail::blank(cell);
+    } else if (staging_area_(x + 1, y) != continuation) {
+        staging_area_(x + 1, y) = continuation;
+        this->mark_dirty(x + 1, y);
+    }
+    if (staging_area_(x, y) != cell) {
+        staging_area_(x, y) = cell;
+        this->mark_dirty(x, y);
+    }
+}
+
+detail::Cell* Paint_buffer::stage_span(std::size_t x,
+                                       std::size_t y,
+                                       std::size_t& length) {
+    if (y >= staging_area_.height() || x >= staging_area_.width()) {
+        length = 0;
+        return nullptr;
+    }
+    length = std::min(length, staging_area_.width() - x);
+    if (length != 0) {
+        // Unchanged cells are skipped when the span is committed on flush.
+        this->mark_dirty(x, y);
+        this->mark_dirty(x + length - 1, y);
+    }
+    return staging_area_.row(y) + x;
+}
+
 void Paint_buffer::flush(bool optimize) {
-    for (std::size_t j{0}; j < staging_area_.height(); ++j) {
-        for (std::size_t i{0}; i < staging_area_.width(); ++i) {
-            if (this->commit(i, j) || !optimize) {
-                engine_.move(i, j);
-                engine_.put_glyph(this->at(i, j));
+    if (repaint_all_) {
+        optimize = false;
+        repaint_all_ = false;
+    }
+    if (optimize) {
+        // Only cells staged since the last flush can differ from the screen.
+        std::sort(std::begin(dirty_rows_), std::end(dirty_rows_));
+        for (std::size_t j : dirty_rows_) {
+            if (j >= staging_area_.height()) {
+                continue;
             }
+            const Dirty_span& span = dirty_spans_[j];
+            const auto last = std::min(span.last, staging_area_.width());
+            this->flush_row(j, span.first, last, true);
         }
+    } else {
+        for (std::size_t j{0}; j < staging_area_.height(); ++j) {
+            this->flush_row(j, 0, staging_area_.width(), false);
+        }
+        // Forces redraw of the entire screen.
+        engine_->touch_all();
     }
-    // Forces redraw of the entire screen.
-    if (!optimize) {
-        engine_.touch_all();
-    }
+    this->clear_dirty();
     // Set cursor
     auto* focus_widg = Focus::focus_widget();
     if (focus_widg != nullptr) {
-        engine_.show_cursor(focus_widg->cursor_visible());
+        engine_->show_cursor(focus_widg->cursor_visible());
         if (focus_widg->cursor_visible()) {
             auto x = focus_widg->x() + focus_widg->cursor_x();
             auto y = focus_widg->y() + focus_widg->cursor_y();
-            engine_.move(x, y);
+            engine_->move(x, y);
         }
     } else {
-        engine_.hide_cursor();
+        engine_->hide_cursor();
     }
-    engine_.refresh();
+    engine_->refresh();
 }
 
 void Paint_buffer::move(std::size_t x, std::size_t y) {
-    engine_.move(x, y);
+    engine_->move(x, y);
 }
 
-const Glyph& Paint_buffer::at(std::size_t x, std::size_t y) const {
-    return backing_store_.at(x, y);
+Glyph Paint_buffer::at(std::size_t x, std::size_t y) const {
+    if (x >= backing_store_.width() || y >= backing_store_.height()) {
+        throw std::out_of_range("Paint_buffer::at() - Index out of range.");
+    }
+    return detail::to_glyph(backing_store_(x, y));
 }
 
 std::size_t Paint_buffer::update_width() {
-    std::size_t width = engine_.screen_width();
+    std::size_t width = engine_->screen_width();
     this->resize(width, staging_area_.height());
     return width;
 }
 
 std::size_t Paint_buffer::update_height() {
-    std::size_t height = engine_.screen_height();
+    std::size_t height = engine_->screen_height();
     this->resize(staging_area_.width(), height);
     return height;
 }
 
 void Paint_buffer::set_color(Color c, RGB values) {
-    engine_.set_rgb(c, values.red, values.green, values.blue);
+    engine_->set_rgb(c, values.red, values.green, values.blue);
 }
 
 void Paint_buffer::resize(std::size_t width, std::size_t height) {
+    if (width == staging_area_.width() && height == staging_area_.height()) {
+        return;
+    }
+    repaint_all_ = true;
     backing_store_.resize(width, height);
     staging_area_.resize(width, height);
+    dirty_spans_.resize(height, Dirty_span{0, 0});
+    auto past_end = [height](std::size_t row) { return row >= height; };
+    dirty_rows_.erase(std::remove_if(std::begin(dirty_rows_),
+                                     std::end(dirty_rows_), past_end),
+                      std::end(dirty_rows_));
+}
+
+// Changed spans are found with find_mismatch() and copied to the backing
+// store as a whole. Unless optimize is false, then the whole range is sent.
+// Wide symbols that lost a half are blanked on the way.
+void Paint_buffer::flush_row(std::size_t y,
+                             std::size_t first,
+                             std::size_t last,
+                             bool optimize) {
+    detail::Cell* staged = staging_area_.row(y);
+    detail::Cell* backing = backing_store_.row(y);
+    std::size_t i{first};
+    while (i < last) {
+        if (optimize) {
+            i += detail::find_mismatch(staged + i, backing + i, last - i);
+            if (i == last) {
+                break;
+            }
+        }
+        std::size_t end{i + 1};
+        while (end < last && (!optimize || staged[end] != backing[end])) {
+            ++end;
+        }
+        pair_wide_cells(staged, staging_area_.width(), i, end);
+        std::copy(staged + i, staged + end, backing + i);
+        this->put_span(y, i, end);
+        i = end;
+    }
 }
 
-bool Paint_buffer::commit(std::size_t x, std::size_t y) {
-    if (staging_area_(x, y) == backing_store_(x, y)) {
-        return false;
+// Cells that are adjacent and share a Brush are sent to the engine as a
+// single run, one move and one attribute setup per run instead of per cell.
+// Continuation cells are covered by the wide symbol before them, so they end
+// a run and are not sent.
+void Paint_buffer::put_span(std::size_t y,
+                            std::size_t first,
+                            std::size_t last) {
+    const detail::Cell* row = backing_store_.row(y);
+    std::size_t i{first};
+    while (i < last) {
+        if (detail::is_continuation(row[i])) {
+            ++i;
+            continue;
+        }
+        const std::size_t run_begin{i};
+        run_.assign(1, detail::to_glyph(row[i]));
+        for (++i; i < last && !detail::is_continuation(row[i]) &&
+                  detail::same_brush(row[i], row[run_begin]);
+             ++i) {
+            // Same Brush as the first Glyph of the run, only the symbol
+            // differs.
+            run_.push_back(run_.front());
+            detail::set_symbol(run_.back(), row[i]);
+        }
+        engine_->put_run(run_begin, y, run_.data(), run_.size());
+    }
+}
+
+void Paint_buffer::mark_dirty(std::size_t x, std::size_t y) {
+    Dirty_span& span = dirty_spans_[y];
+    if (span.first >= span.last) {
+        span = Dirty_span{x, x + 1};
+        dirty_rows_.push_back(y);
+        return;
+    }
+    span.first = std::min(span.first, x);
+    span.last = std::max(span.last, x + 1);
+}
+
+void Paint_buffer::clear_dirty() {
+    for (std::size_t j : dirty_rows_) {
+        if (j < dirty_spans_.size()) {
+            dirty_spans_[j] = Dirty_span{0, 0};
+        }
     }
-    backing_store_(x, y) = staging_area_(x, y);
-    return true;
+    dirty_rows_.clear();
 }
 
 }  // namespace cppurses
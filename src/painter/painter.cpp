@@ -1,5 +1,7 @@
 #include <cppurses/painter/brush.hpp>
 #include <cppurses/painter/color.hpp>
+#include <cppurses/painter/detail/cell.hpp>
+#include <cppurses/painter/detail/glyph_rope.hpp>
 #include <cppurses/painter/glyph.hpp>
 #include <cppurses/painter/glyph_string.hpp>
 #include <cppurses/painter/paint_buffer.hpp>
@@ -11,9 +13,47 @@
 
 #include <optional/optional.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 
+namespace {
+using namespace cppurses;
+
+// Moves the length Cells at cells apart so each wide Cell is followed by its
+// continuation, keeping those that fit in columns. A wide Cell with one column
+// left is blanked. Returns the number of columns used.
+std::size_t spread_wide_cells(detail::Cell* cells,
+                              std::size_t length,
+                              std::size_t columns) {
+    std::size_t fits{0};
+    std::size_t used{0};
+    for (; fits < length; ++fits) {
+        const std::size_t width{detail::is_wide(cells[fits]) ? 2U : 1U};
+        if (used + width > columns) {
+            break;
+        }
+        used += width;
+    }
+    std::size_t end{used};
+    if (fits < length && used < columns) {
+        cells[end] = cells[fits];
+        detail::blank(cells[end++]);
+    }
+    // Back to front, so no Cell is overwritten before it is moved.
+    std::size_t column{used};
+    for (std::size_t i{fits}; column != i;) {
+        --i;
+        if (detail::is_wide(cells[i])) {
+            cells[--column] = detail::continuation_of(cells[i]);
+        }
+        cells[--column] = cells[i];
+    }
+    return end;
+}
+
+}  // namespace
+
 namespace cppurses {
 
 Painter::Painter(Widget* widget) : widget_{widget} {}
@@ -34,8 +74,14 @@ void Painter::put(const Glyph_string& text, std::size_t x, std::size_t y) {
            // tabspace
            // should be here and textbox should just account for it.
         else {
+            const std::size_t width{g.width()};
+            if (width == 2 && widget_->cursor_x() + 1 >= widget_->width()) {
+                // Half a wide symbol would be painted outside the Widget.
+                g.set_symbol(' ');
+            }
             System::paint_buffer()->stage(glob_x, glob_y, g);
-            move_cursor(*widget_, widget_->cursor_x() + 1, widget_->cursor_y());
+            move_cursor(*widget_, widget_->cursor_x() + width,
+                        widget_->cursor_y());
         }
     }
     if (!move_cursor_on_put) {
@@ -51,6 +97,34 @@ void Painter::put(const Glyph_string& text) {
     this->put(text, widget_->cursor_x(), widget_->cursor_y());
 }
 
+void Painter::put(const detail::Glyph_rope& text,
+                  std::size_t index,
+                  std::size_t length,
+                  std::size_t x,
+                  std::size_t y) {
+    if (!widget_->on_tree() || !widget_->visible() ||
+        x >= widget_->width() || y >= widget_->height()) {
+        return;
+    }
+    length = std::min(length, widget_->width() - x);
+    detail::Cell* cells{System::paint_buffer()->stage_span(
+        widget_->x() + x, widget_->y() + y, length)};
+    std::size_t columns{length};
+    const std::size_t wide{text.copy(index, length, cells)};
+    if (wide != 0) {
+        // Each wide Glyph takes up one more column, stage those too.
+        columns = std::min(length + wide, widget_->width() - x);
+        System::paint_buffer()->stage_span(widget_->x() + x,
+                                           widget_->y() + y, columns);
+        columns = spread_wide_cells(cells, length, columns);
+    }
+    detail::Cell defaults;
+    detail::set_brush(defaults, widget_->brush);
+    for (std::size_t i{0}; i < columns; ++i) {
+        detail::add_default_brush(cells[i], defaults);
+    }
+}
+
 void Painter::fill(std::size_t x,
                    std::size_t y,
                    std::size_t width,
@@ -273,7 +347,8 @@ void Painter::unbound_put_string(std::size_t glob_x,
     }
     for (Glyph g : gs) {
         add_default_attributes(&g);
-        System::paint_buffer()->stage(glob_x++, glob_y, g);
+        System::paint_buffer()->stage(glob_x, glob_y, g);
+        glob_x += g.width();
     }
 }
 
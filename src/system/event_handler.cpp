@@ -1,3 +1,4 @@
+#include <cppurses/system/detail/find_widget_at.hpp>
 #include <cppurses/system/event_handler.hpp>
 #include <cppurses/system/events/disable_event.hpp>
 #include <cppurses/system/events/enable_event.hpp>
@@ -6,20 +7,26 @@
 #include <cppurses/widget/point.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <iterator>
 #include <signals/signals.hpp>
+#include <string>
 #include <vector>
 
 namespace cppurses {
 class Widget;
 
 Event_handler::~Event_handler() {
+    for (std::size_t id : timers_) {
+        System::stop_timer(id);
+    }
     destroyed(this);
 }
 
 void Event_handler::set_enabled(bool enabled) {
     enabled_ = enabled;
+    detail::invalidate_hit_grid();
     if (enabled) {
         System::post_event<Enable_event>(this);
     } else {
@@ -58,6 +65,26 @@ const std::vector<Event_handler*>& Event_handler::get_event_filters() const {
     return event_filters_;
 }
 
+std::size_t Event_handler::start_timer(std::chrono::milliseconds interval,
+                                       bool repeating) {
+    // Forget single shot timers that have already fired.
+    auto is_done = [](std::size_t id) { return !System::timer_active(id); };
+    timers_.erase(std::remove_if(std::begin(timers_), std::end(timers_),
+                                 is_done),
+                  std::end(timers_));
+    const std::size_t id{System::start_timer(this, interval, repeating)};
+    timers_.push_back(id);
+    return id;
+}
+
+void Event_handler::stop_timer(std::size_t timer_id) {
+    auto position = std::find(std::begin(timers_), std::end(timers_), timer_id);
+    if (position != std::end(timers_)) {
+        timers_.erase(position);
+        System::stop_timer(timer_id);
+    }
+}
+
 // - - - - - - - - - - - - - - Event Handlers - - - - - - - - - - - - - - - - -
 bool Event_handler::enable_event() {
     return false;
@@ -126,6 +153,14 @@ bool Event_handler::focus_out_event() {
     return true;
 }
 
+bool Event_handler::timer_event(std::size_t timer_id) {
+    return false;
+}
+
+bool Event_handler::paste_event(const std::string& text) {
+    return false;
+}
+
 // - - - - - - - - - - - - Event Filter Handlers - - - - - - - - - - - - - - - -
 bool Event_handler::child_added_event_filter(Event_handler* receiver,
                                              Widget* child) {
@@ -252,4 +287,14 @@ bool Event_handler::clear_screen_event_filter(Event_handler* receiver) {
     return false;
 }
 
+bool Event_handler::timer_event_filter(Event_handler* receiver,
+                                       std::size_t timer_id) {
+    return false;
+}
+
+bool Event_handler::paste_event_filter(Event_handler* receiver,
+                                       const std::string& text) {
+    return false;
+}
+
 }  // namespace cppurses
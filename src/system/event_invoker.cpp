@@ -16,39 +16,75 @@ void send_event(const Event& event) {
     }
 }
 
+bool matches(const Event& event,
+             Event::Type type_filter,
+             Event_handler* object_filter) {
+    // Object Filter
+    if (object_filter != nullptr && event.receiver() != object_filter) {
+        return false;
+    }
+    // Deferred Delete Filter
+    if (event.type() == Event::DeferredDelete) {
+        return type_filter == Event::DeferredDelete;
+    }
+    return type_filter == Event::None || type_filter == event.type();
+}
+
 }  // namespace
 
 namespace cppurses {
 class Event_handler;
 namespace detail {
 
-void Event_invoker::invoke(Event_queue& queue,
-                           Event::Type type_filter,
-                           Event_handler* object_filter) {
-    auto event_iter = std::begin(queue.queue_);
-    while (event_iter != std::end(queue.queue_)) {
-        Event_handler* receiver = (*event_iter)->receiver();
-        auto type = (*event_iter)->type();
-        // Object Filter
-        if (receiver != object_filter && object_filter != nullptr) {
-            ++event_iter;
-            continue;
-        }
-        // Deferred Delete Filter
-        if (Event::DeferredDelete == type &&
-            Event::DeferredDelete != type_filter) {
-            ++event_iter;
-            continue;
+template <typename Predicate>
+void Event_invoker::invoke_matching(Event_queue& queue,
+                                    bool take_all,
+                                    Predicate predicate) {
+    Event_queue::Queue_t batch;
+    do {
+        batch.clear();
+        // Take every matching Event in one pass. Events posted while the batch
+        // is being sent wait in the queue for the next batch.
+        if (take_all) {
+            queue.move_all_to(batch);
+        } else {
+            auto iter = std::begin(queue.queue_);
+            while (iter != std::end(queue.queue_)) {
+                auto next = std::next(iter);
+                if (predicate(**iter)) {
+                    queue.move_to(batch, iter);
+                }
+                iter = next;
+            }
         }
-        // Event Filter Match OR No Event Filter - Send Event
-        if (type_filter == Event::None || type_filter == type) {
-            auto event = std::move(*event_iter);
-            queue.queue_.erase(event_iter);
+        for (const auto& event : batch) {
+            // Replaced by an Event posted while this batch was being sent.
+            if (event == nullptr) {
+                continue;
+            }
+            queue.release(*event);
             send_event(*event);
-            event_iter = std::begin(queue.queue_);
-            continue;
         }
-    }
+    } while (!batch.empty());
+}
+
+void Event_invoker::invoke(Event_queue& queue,
+                           Event::Type type_filter,
+                           Event_handler* object_filter) {
+    const bool take_all{type_filter == Event::None &&
+                        object_filter == nullptr &&
+                        queue.deferred_deletes_.empty()};
+    this->invoke_matching(
+        queue, take_all, [type_filter, object_filter](const Event& event) {
+            return matches(event, type_filter, object_filter);
+        });
+}
+
+void Event_invoker::invoke_except(Event_queue& queue, Event::Type excluded) {
+    this->invoke_matching(queue, false, [excluded](const Event& event) {
+        return event.type() != excluded &&
+               event.type() != Event::DeferredDelete;
+    });
 }
 
 }  // namespace detail
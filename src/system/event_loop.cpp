@@ -1,18 +1,59 @@
 #include <cppurses/painter/paint_buffer.hpp>
 #include <cppurses/system/detail/abstract_event_listener.hpp>
+#include <cppurses/system/detail/timer_wheel.hpp>
 #include <cppurses/system/event.hpp>
 #include <cppurses/system/event_loop.hpp>
+#include <cppurses/system/events/timer_event.hpp>
 #include <cppurses/system/system.hpp>
 
+#include <signals/slot.hpp>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
 #include <utility>
 
 namespace cppurses {
 
+Event_loop::Event_loop() {
+    int fds[2];
+    if (::pipe(fds) == 0) {
+        wakeup_read_ = fds[0];
+        wakeup_write_ = fds[1];
+        for (int fd : fds) {
+            ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+            ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+    }
+}
+
+Event_loop::~Event_loop() {
+    if (wakeup_read_ != -1) {
+        ::close(wakeup_read_);
+        ::close(wakeup_write_);
+    }
+}
+
 int Event_loop::run() {
+    thread_id_.store(std::this_thread::get_id());
+    // Layouts set the geometry of their children when painted, the first
+    // frame has to be rendered before any input is sent.
+    last_render_ = Clock::time_point{};
     exit_ = false;
     while (!exit_) {
         this->process_events();
     }
+    if (render_pending_) {
+        this->render();
+    }
     return return_code_;
 }
 
@@ -21,14 +62,181 @@ void Event_loop::exit(int return_code) {
     exit_ = true;
 }
 
+void Event_loop::wake() {
+    if (wakeup_write_ != -1) {
+        const char byte{0};
+        // If the pipe is full the loop is going to wake up anyways.
+        while (::write(wakeup_write_, &byte, 1) == -1 && errno == EINTR) {
+        }
+    }
+}
+
+void Event_loop::post(std::unique_ptr<Event> event) {
+    if (this->on_loop_thread()) {
+        event_queue.append(std::move(event));
+        return;
+    }
+    posted_.push(std::move(event));
+    if (!wake_pending_.exchange(true, std::memory_order_acq_rel)) {
+        this->wake();
+    }
+}
+
+bool Event_loop::on_loop_thread() const {
+    return thread_id_.load(std::memory_order_relaxed) ==
+           std::this_thread::get_id();
+}
+
+void Event_loop::watch_fd(int fd, sig::Slot<void()> on_readable) {
+    watched_[fd] = std::move(on_readable);
+    this->wake();
+}
+
+void Event_loop::unwatch_fd(int fd) {
+    watched_.erase(fd);
+}
+
+void Event_loop::set_frame_rate(unsigned frames_per_second) {
+    frame_interval_ = Clock::duration::zero();
+    if (frames_per_second != 0) {
+        frame_interval_ =
+            std::chrono::duration_cast<Clock::duration>(
+                std::chrono::seconds{1}) /
+            frames_per_second;
+    }
+}
+
+std::size_t Event_loop::start_timer(Event_handler* receiver,
+                                    std::chrono::milliseconds interval,
+                                    bool repeating) {
+    return timers_.add(receiver, interval, repeating);
+}
+
+void Event_loop::stop_timer(std::size_t timer_id) {
+    timers_.remove(timer_id);
+}
+
+bool Event_loop::timer_active(std::size_t timer_id) const {
+    return timers_.contains(timer_id);
+}
+
 void Event_loop::process_events() {
-    invoker_.invoke(event_queue);
+    this->take_posted_events();
+    if (!event_queue.empty()) {
+        render_pending_ = true;
+    }
+    const bool frame_due{this->frame_timeout(Clock::now()) == 0};
+    if (frame_due) {
+        invoker_.invoke(event_queue);
+    } else {
+        invoker_.invoke_except(event_queue, Event::Paint);
+    }
     if (!exit_) {
         invoker_.invoke(event_queue, Event::DeferredDelete);
-        System::paint_buffer()->flush(true);
-        // Blocking Call
-        auto event_ptr = System::event_listener()->get_input();
-        event_queue.append(std::move(event_ptr));
+        if (frame_due && render_pending_) {
+            this->render();
+        }
+        this->wait_for_input();
+    }
+}
+
+void Event_loop::render() {
+    // Not only Paint Events, a Layout's paint_event() posts Move and Resize
+    // Events to its children, which post Paint Events in turn.
+    invoker_.invoke(event_queue);
+    System::paint_buffer()->flush(true);
+    last_render_ = Clock::now();
+    render_pending_ = false;
+}
+
+int Event_loop::frame_timeout(Clock::time_point now) const {
+    const auto next_frame = last_render_ + frame_interval_;
+    if (now >= next_frame) {
+        return 0;
+    }
+    // Rounded up, waking early would only mean another poll() call.
+    const auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(
+        next_frame - now + std::chrono::milliseconds{1} -
+        Clock::duration{1});
+    return static_cast<int>(wait.count());
+}
+
+void Event_loop::wait_for_input() {
+    const int input_fd{System::event_listener()->file_descriptor()};
+    poll_fds_.clear();
+    if (input_fd >= 0) {
+        poll_fds_.push_back(::pollfd{input_fd, POLLIN, 0});
+    }
+    if (wakeup_read_ != -1) {
+        poll_fds_.push_back(::pollfd{wakeup_read_, POLLIN, 0});
+    }
+    for (const auto& fd_slot : watched_) {
+        poll_fds_.push_back(::pollfd{fd_slot.first, POLLIN, 0});
+    }
+
+    // Without an input file descriptor the listener is asked every iteration.
+    int timeout{input_fd >= 0 ? timers_.next_timeout() : 0};
+    if (render_pending_ && timeout != 0) {
+        const int until_frame{this->frame_timeout(Clock::now())};
+        timeout = timeout < 0 ? until_frame : std::min(timeout, until_frame);
+    }
+    const int ready = ::poll(poll_fds_.data(), poll_fds_.size(), timeout);
+    this->post_timer_events();
+    if (ready == -1) {
+        // EINTR, likely SIGWINCH; ncurses reports it through getch().
+        this->read_input();
+        return;
+    }
+    for (const ::pollfd& p : poll_fds_) {
+        if (p.revents == 0) {
+            continue;
+        }
+        if (p.fd == input_fd) {
+            this->read_input();
+        } else if (p.fd == wakeup_read_) {
+            char buffer[64];
+            while (::read(wakeup_read_, buffer, sizeof(buffer)) > 0) {
+            }
+        } else {
+            // The slot might unwatch itself or other file descriptors.
+            auto found = watched_.find(p.fd);
+            if (found != std::end(watched_)) {
+                auto on_readable = found->second;
+                on_readable();
+            }
+        }
+    }
+    if (input_fd < 0) {
+        this->read_input();
+    }
+}
+
+void Event_loop::post_timer_events() {
+    due_timers_.clear();
+    timers_.advance(due_timers_);
+    for (const auto& expired : due_timers_) {
+        event_queue.append(
+            std::make_unique<Timer_event>(expired.receiver, expired.id));
+    }
+}
+
+void Event_loop::take_posted_events() {
+    // Cleared first, a post() racing with the drain below wakes the loop again.
+    wake_pending_.store(false, std::memory_order_release);
+    std::unique_ptr<Event> event;
+    while (posted_.pop(event)) {
+        event_queue.append(std::move(event));
+    }
+}
+
+void Event_loop::read_input() {
+    auto* listener = System::event_listener();
+    if (listener->file_descriptor() < 0) {
+        event_queue.append(listener->get_input());
+        return;
+    }
+    for (auto& event : listener->get_inputs()) {
+        event_queue.append(std::move(event));
     }
 }
 
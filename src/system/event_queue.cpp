@@ -3,9 +3,32 @@
 #include <cppurses/system/events/deferred_delete_event.hpp>
 #include <cppurses/widget/widget.hpp>
 
-#include <algorithm>
 #include <iterator>
 #include <memory>
+#include <utility>
+
+namespace {
+using namespace cppurses;
+
+bool is_coalesced(Event::Type type) {
+    return type == Event::Paint || type == Event::Move ||
+           type == Event::Resize || type == Event::ClearScreen;
+}
+
+const Widget* to_delete(const Event& event) {
+    return static_cast<const Deferred_delete_event&>(event).to_delete();
+}
+
+bool is_descendant(const Widget* w, const Widget* ancestor) {
+    for (w = w->parent(); w != nullptr; w = w->parent()) {
+        if (w == ancestor) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
 
 namespace cppurses {
 namespace detail {
@@ -15,41 +38,94 @@ void Event_queue::append(std::unique_ptr<Event> event) {
         return;
     }
     // Optimize out duplicate expensive events.
-    Event::Type type = event->type();
-    if (type == Event::Paint || type == Event::Move || type == Event::Resize ||
-        type == Event::ClearScreen || type == Event::DeferredDelete) {
-        auto is_same_event = [&type, &event](const auto& e) {
-            return (e->type() == type) && (e->receiver() == event->receiver());
-        };
-        auto begin = std::begin(queue_);
-        auto end = std::end(queue_);
-        auto position = std::find_if(begin, end, is_same_event);
-        if (position != end) {
-            queue_.erase(position);
+    const Event::Type type = event->type();
+    if (is_coalesced(type)) {
+        Key key{event->receiver(), type};
+        auto found = coalesced_.find(key);
+        if (found != std::end(coalesced_)) {
+            this->remove(found->second);
+            coalesced_.erase(found);
+        }
+        queue_.emplace_back(std::move(event));
+        coalesced_.emplace(key, Entry{std::prev(std::end(queue_)), false});
+        return;
+    }
+    if (type == Event::DeferredDelete) {
+        const Widget* widg = to_delete(*event);
+        if (this->parent_pending_delete(widg)) {
+            return;
         }
-        if (type == Event::DeferredDelete) {
-            remove_dd_children(*event);
+        auto found = deferred_deletes_.find(widg);
+        if (found != std::end(deferred_deletes_)) {
+            this->remove(found->second);
+            deferred_deletes_.erase(found);
         }
+        this->remove_dd_children(widg);
+        queue_.emplace_back(std::move(event));
+        deferred_deletes_.emplace(widg,
+                                  Entry{std::prev(std::end(queue_)), false});
+        return;
     }
     queue_.emplace_back(std::move(event));
 }
 
-void Event_queue::remove_dd_children(const Event& new_event) {
-    Widget* parent =
-        static_cast<const Deferred_delete_event&>(new_event).to_delete();
-    auto is_child = [parent](const auto& event_ptr) {
-        if (event_ptr == nullptr) {
-            return false;
+void Event_queue::move_to(Queue_t& batch, Queue_t::iterator position) {
+    const Event& event{**position};
+    const Event::Type type = event.type();
+    if (is_coalesced(type)) {
+        coalesced_.at(Key{event.receiver(), type}).in_batch = true;
+    } else if (type == Event::DeferredDelete) {
+        deferred_deletes_.at(to_delete(event)).in_batch = true;
+    }
+    batch.splice(std::end(batch), queue_, position);
+}
+
+void Event_queue::move_all_to(Queue_t& batch) {
+    batch.splice(std::end(batch), queue_);
+    for (auto& key_entry : coalesced_) {
+        key_entry.second.in_batch = true;
+    }
+    for (auto& widget_entry : deferred_deletes_) {
+        widget_entry.second.in_batch = true;
+    }
+}
+
+void Event_queue::release(const Event& event) {
+    const Event::Type type = event.type();
+    if (is_coalesced(type)) {
+        coalesced_.erase(Key{event.receiver(), type});
+    } else if (type == Event::DeferredDelete) {
+        deferred_deletes_.erase(to_delete(event));
+    }
+}
+
+void Event_queue::remove(const Entry& entry) {
+    if (entry.in_batch) {
+        entry.position->reset();
+    } else {
+        queue_.erase(entry.position);
+    }
+}
+
+void Event_queue::remove_dd_children(const Widget* parent) {
+    auto iter = std::begin(deferred_deletes_);
+    while (iter != std::end(deferred_deletes_)) {
+        if (is_descendant(iter->first, parent)) {
+            this->remove(iter->second);
+            iter = deferred_deletes_.erase(iter);
+        } else {
+            ++iter;
         }
-        if (event_ptr->type() == Event::DeferredDelete) {
-            Widget* child =
-                static_cast<Deferred_delete_event&>(*event_ptr).to_delete();
-            return parent->contains_child(child);
+    }
+}
+
+bool Event_queue::parent_pending_delete(const Widget* w) const {
+    for (w = w->parent(); w != nullptr; w = w->parent()) {
+        if (deferred_deletes_.count(w) != 0) {
+            return true;
         }
-        return false;
-    };
-    auto pos = std::remove_if(std::begin(queue_), std::end(queue_), is_child);
-    queue_.erase(pos, std::end(queue_));
+    }
+    return false;
 }
 
 }  // namespace detail
@@ -0,0 +1,33 @@
+#include <cppurses/system/detail/find_widget_at.hpp>
+#include <cppurses/system/detail/hit_grid.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/widget.hpp>
+
+#include <cstddef>
+
+namespace {
+
+cppurses::detail::Hit_grid& hit_grid() {
+    static cppurses::detail::Hit_grid grid;
+    return grid;
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+Widget* find_widget_at(std::size_t x, std::size_t y) {
+    return hit_grid().at(System::head(), x, y);
+}
+
+void invalidate_hit_area(const Widget& w) {
+    hit_grid().invalidate(w);
+}
+
+void invalidate_hit_grid() {
+    hit_grid().invalidate_all();
+}
+
+}  // namespace detail
+}  // namespace cppurses
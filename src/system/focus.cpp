@@ -25,10 +25,9 @@ Widget* next_tab_focus() {
     std::size_t i{0};
     while (i < widgets.size()) {
         Widget* current = widgets[i];
-        auto children = current->children();
-        // TODO std::copy instead
-        std::for_each(std::begin(children), std::end(children),
-                      [&widgets](Widget* p) { widgets.push_back(p); });
+        const auto children = current->children();
+        widgets.insert(std::end(widgets), std::begin(children),
+                       std::end(children));
         ++i;
     }
 
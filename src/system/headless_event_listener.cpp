@@ -0,0 +1,94 @@
+#include <cppurses/system/detail/find_widget_at.hpp>
+#include <cppurses/system/detail/headless_event_listener.hpp>
+#include <cppurses/system/event.hpp>
+#include <cppurses/system/events/key_event.hpp>
+#include <cppurses/system/events/mouse_event.hpp>
+#include <cppurses/system/events/paste_event.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/focus.hpp>
+#include <cppurses/system/key.hpp>
+#include <cppurses/system/mouse_button.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/widget.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace cppurses {
+namespace detail {
+
+std::unique_ptr<Event> Headless_event_listener::get_input() const {
+    if (script_.empty()) {
+        System::exit();
+        return nullptr;
+    }
+    Input input{std::move(script_.front())};
+    script_.pop_front();
+    switch (input.kind) {
+        case Input::Key_press:
+            return std::make_unique<Key_press_event>(Focus::focus_widget(),
+                                                     input.key);
+
+        case Input::Mouse_press:
+        case Input::Mouse_release: {
+            Widget* receiver = find_widget_at(input.position.x,
+                                              input.position.y);
+            if (receiver == nullptr) {
+                return nullptr;
+            }
+            Point local{input.position.x - receiver->x(),
+                        input.position.y - receiver->y()};
+            if (input.kind == Input::Mouse_press) {
+                return std::make_unique<Mouse_press_event>(
+                    receiver, input.button, input.position, local, 0);
+            }
+            return std::make_unique<Mouse_release_event>(
+                receiver, input.button, input.position, local, 0);
+        }
+
+        case Input::Resize:
+            return std::make_unique<Resize_event>(
+                System::head(),
+                Area{System::max_width(), System::max_height()});
+
+        case Input::Paste:
+            return std::make_unique<Paste_event>(Focus::focus_widget(),
+                                                 std::move(input.text));
+    }
+    return nullptr;
+}
+
+void Headless_event_listener::push_key(Key key) {
+    script_.push_back(Input{Input::Key_press, key, Mouse_button::None, {}});
+}
+
+void Headless_event_listener::push_keys(const std::string& text) {
+    for (char c : text) {
+        this->push_key(static_cast<Key>(c));
+    }
+}
+
+void Headless_event_listener::push_mouse_press(Mouse_button button,
+                                               Point global) {
+    script_.push_back(Input{Input::Mouse_press, Key::Null, button, global});
+}
+
+void Headless_event_listener::push_mouse_release(Mouse_button button,
+                                                 Point global) {
+    script_.push_back(Input{Input::Mouse_release, Key::Null, button, global});
+}
+
+void Headless_event_listener::push_resize() {
+    script_.push_back(Input{Input::Resize, Key::Null, Mouse_button::None, {}});
+}
+
+void Headless_event_listener::push_paste(std::string text) {
+    script_.push_back(Input{Input::Paste, Key::Null, Mouse_button::None, {},
+                            std::move(text)});
+}
+
+}  // namespace detail
+}  // namespace cppurses
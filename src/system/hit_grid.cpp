@@ -0,0 +1,106 @@
+#include <cppurses/system/detail/hit_grid.hpp>
+#include <cppurses/widget/widget.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+namespace {
+
+// Past this many pending areas a full rebuild is cheaper, this is the case
+// after a Layout has moved all of its children.
+const std::size_t max_dirty_areas{32};
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+Widget* Hit_grid::at(Widget* head, std::size_t x, std::size_t y) {
+    if (head == nullptr) {
+        return nullptr;
+    }
+    const std::size_t width{head->x() + head->width()};
+    const std::size_t height{head->y() + head->height()};
+    if (head != head_ || width != width_ || height != height_) {
+        head_ = head;
+        width_ = width;
+        height_ = height;
+        all_dirty_ = true;
+    }
+    if (all_dirty_) {
+        this->rebuild(*head);
+    } else if (!dirty_.empty()) {
+        for (const Rect& area : dirty_) {
+            this->rebuild(*head, area);
+        }
+        dirty_.clear();
+    }
+    if (x >= width_ || y >= height_) {
+        return nullptr;
+    }
+    return owners_[y * width_ + x];
+}
+
+void Hit_grid::invalidate(const Widget& w) {
+    if (all_dirty_) {
+        return;
+    }
+    if (dirty_.size() == max_dirty_areas) {
+        this->invalidate_all();
+        return;
+    }
+    dirty_.push_back(Rect{w.x(), w.y(), w.width(), w.height()});
+}
+
+void Hit_grid::invalidate_all() {
+    all_dirty_ = true;
+    dirty_.clear();
+}
+
+void Hit_grid::rebuild(Widget& head) {
+    owners_.assign(width_ * height_, nullptr);
+    this->fill(head, Rect{0, 0, width_, height_});
+    all_dirty_ = false;
+    dirty_.clear();
+}
+
+void Hit_grid::rebuild(Widget& head, Rect area) {
+    const std::size_t x_end{std::min(area.x + area.width, width_)};
+    const std::size_t y_end{std::min(area.y + area.height, height_)};
+    if (area.x >= x_end || area.y >= y_end) {
+        return;
+    }
+    for (std::size_t y{area.y}; y < y_end; ++y) {
+        auto row = std::begin(owners_) + y * width_;
+        std::fill(row + area.x, row + x_end, nullptr);
+    }
+    this->fill(head, Rect{area.x, area.y, x_end - area.x, y_end - area.y});
+}
+
+void Hit_grid::fill(Widget& w, Rect clip) {
+    if (!w.enabled() || !w.visible()) {
+        return;
+    }
+    // Intersection of w and clip. Children are only found within their
+    // parent, so they are clipped to it as well.
+    const std::size_t x{std::max(w.x(), clip.x)};
+    const std::size_t y{std::max(w.y(), clip.y)};
+    const std::size_t x_end{std::min(w.x() + w.width(), clip.x + clip.width)};
+    const std::size_t y_end{std::min(w.y() + w.height(), clip.y + clip.height)};
+    if (x >= x_end || y >= y_end) {
+        return;
+    }
+    for (std::size_t j{y}; j < y_end; ++j) {
+        auto row = std::begin(owners_) + j * width_;
+        std::fill(row + x, row + x_end, &w);
+    }
+    const Rect area{x, y, x_end - x, y_end - y};
+    const auto children = w.children();
+    for (auto child = children.rbegin(); child != children.rend(); ++child) {
+        this->fill(**child, area);
+    }
+}
+
+}  // namespace detail
+}  // namespace cppurses
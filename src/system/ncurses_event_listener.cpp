@@ -1,7 +1,9 @@
+#include <cppurses/system/detail/find_widget_at.hpp>
 #include <cppurses/system/detail/ncurses_event_listener.hpp>
 #include <cppurses/system/event.hpp>
 #include <cppurses/system/events/key_event.hpp>
 #include <cppurses/system/events/mouse_event.hpp>
+#include <cppurses/system/events/paste_event.hpp>
 #include <cppurses/system/events/resize_event.hpp>
 #include <cppurses/system/focus.hpp>
 #include <cppurses/system/key.hpp>
@@ -12,30 +14,61 @@
 #include <cppurses/widget/widget.hpp>
 
 #include <ncurses.h>
+#include <unistd.h>
 
+#include <cerrno>
 #include <cstddef>
+#include <cstring>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace {
 
-cppurses::Widget* find_widget_at(std::size_t x, std::size_t y) {
-    cppurses::Widget* widg = cppurses::System::head();
-    if (widg == nullptr || !has_coordinates(*widg, x, y)) {
-        return nullptr;
+const int escape{27};
+const char* const paste_on{"\033[?2004h"};
+const char* const paste_off{"\033[?2004l"};
+const char* const paste_start{"\033[200~"};
+const char* const paste_end{"\033[201~"};
+
+void write_sequence(const char* sequence) {
+    const std::size_t length{std::strlen(sequence)};
+    std::size_t written{0};
+    while (written < length) {
+        const auto n = ::write(STDOUT_FILENO, sequence + written,
+                               length - written);
+        if (n == -1 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return;
+        }
+        written += n;
     }
-    bool keep_going = true;
-    while (keep_going && !widg->children().empty()) {
-        for (cppurses::Widget* child : widg->children()) {
-            if (has_coordinates(*child, x, y) && child->enabled()) {
-                widg = child;
-                keep_going = true;
-                break;
+}
+
+bool ends_with(const std::string& text, const std::string& suffix) {
+    return text.size() >= suffix.size() &&
+           text.compare(text.size() - suffix.size(), suffix.size(), suffix) ==
+               0;
+}
+
+// Terminals send line breaks in pasted text as "\r" or "\r\n".
+std::string normalize_newlines(const std::string& text) {
+    std::string result;
+    result.reserve(text.size());
+    for (std::size_t i{0}; i < text.size(); ++i) {
+        if (text[i] == '\r') {
+            result.push_back('\n');
+            if (i + 1 < text.size() && text[i + 1] == '\n') {
+                ++i;
             }
-            keep_going = false;
+        } else {
+            result.push_back(text[i]);
         }
     }
-    return widg;
+    return result;
 }
 
 }  // namespace
@@ -43,8 +76,92 @@ cppurses::Widget* find_widget_at(std::size_t x, std::size_t y) {
 namespace cppurses {
 namespace detail {
 
+NCurses_event_listener::NCurses_event_listener() {
+    write_sequence(paste_on);
+}
+
+NCurses_event_listener::~NCurses_event_listener() {
+    write_sequence(paste_off);
+}
+
 std::unique_ptr<Event> NCurses_event_listener::get_input() const {
-    int input = ::getch();  // blocking call
+    return this->next_event();
+}
+
+std::vector<std::unique_ptr<Event>> NCurses_event_listener::get_inputs()
+    const {
+    std::vector<std::unique_ptr<Event>> events;
+    auto event = this->next_event();
+    while (event != nullptr) {
+        events.push_back(std::move(event));
+        event = this->next_event();
+    }
+    return events;
+}
+
+std::unique_ptr<Event> NCurses_event_listener::next_event() const {
+    std::unique_ptr<Event> event{nullptr};
+    // Skip input that does not translate to an Event, such as unknown mouse
+    // buttons, so nullptr is only returned once getch() has nothing left.
+    while (event == nullptr) {
+        if (in_paste_) {
+            return this->read_paste();
+        }
+        int input = ::getch();  // non-blocking, see initialize_ncurses()
+        if (input == ERR) {
+            return nullptr;
+        }
+        if (input == escape && this->paste_begins()) {
+            in_paste_ = true;
+            continue;
+        }
+        event = this->make_event(input);
+    }
+    return event;
+}
+
+bool NCurses_event_listener::paste_begins() const {
+    // paste_start without its leading escape.
+    const std::string marker{paste_start + 1};
+    std::string read;
+    for (char expected : marker) {
+        const int input = ::getch();
+        if (input != ERR) {
+            read.push_back(static_cast<char>(input));
+        }
+        if (input != expected) {
+            // ungetch() pushes onto a stack, last in is read first.
+            for (auto c = read.rbegin(); c != read.rend(); ++c) {
+                ::ungetch(static_cast<unsigned char>(*c));
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+std::unique_ptr<Event> NCurses_event_listener::read_paste() const {
+    const std::string end_marker{paste_end};
+    int input = ::getch();
+    while (input != ERR) {
+        // Keys and resizes that ncurses reports mid-paste are dropped.
+        if (input <= 0xFF) {
+            paste_.push_back(static_cast<char>(input));
+        }
+        if (ends_with(paste_, end_marker)) {
+            paste_.resize(paste_.size() - end_marker.size());
+            in_paste_ = false;
+            auto event = std::make_unique<Paste_event>(
+                Focus::focus_widget(), normalize_newlines(paste_));
+            paste_.clear();
+            return event;
+        }
+        input = ::getch();
+    }
+    return nullptr;
+}
+
+std::unique_ptr<Event> NCurses_event_listener::make_event(int input) const {
     std::unique_ptr<Event> event{nullptr};
     switch (input) {
         case KEY_MOUSE:
@@ -64,6 +181,10 @@ std::unique_ptr<Event> NCurses_event_listener::get_input() const {
     return event;
 }
 
+int NCurses_event_listener::file_descriptor() const {
+    return STDIN_FILENO;
+}
+
 void NCurses_event_listener::enable_ctrl_characters() {
     ::raw();
 }
@@ -0,0 +1,33 @@
+#include <cppurses/system/event_handler.hpp>
+#include <cppurses/system/events/paste_event.hpp>
+#include <cppurses/system/key.hpp>
+
+#include <string>
+#include <utility>
+
+namespace cppurses {
+
+Paste_event::Paste_event(Event_handler* receiver, std::string text)
+    : Input_event{Event::Paste, receiver}, text_{std::move(text)} {}
+
+bool Paste_event::send() const {
+    if (!receiver_->enabled()) {
+        return false;
+    }
+    if (receiver_->paste_event(text_)) {
+        return true;
+    }
+    // Pasted text does not trigger Shortcuts or Tab focus changes.
+    bool handled{false};
+    for (char c : text_) {
+        const auto key = static_cast<Key>(static_cast<unsigned char>(c));
+        handled = receiver_->key_press_event(key, key_to_char(key)) || handled;
+    }
+    return handled;
+}
+
+bool Paste_event::filter_send(Event_handler* filter) const {
+    return filter->paste_event_filter(receiver_, text_);
+}
+
+}  // namespace cppurses
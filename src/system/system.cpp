@@ -1,3 +1,5 @@
+#include <cppurses/painter/detail/ncurses_paint_engine.hpp>
+#include <cppurses/painter/detail/paint_engine.hpp>
 #include <cppurses/painter/paint_buffer.hpp>
 #include <cppurses/painter/palette.hpp>
 #include <cppurses/system/detail/event_queue.hpp>
@@ -13,6 +15,8 @@
 
 #include <signals/slot.hpp>
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <utility>
 
@@ -27,12 +31,12 @@ Widget* System::head_ = nullptr;  // NOLINT
 Event_loop System::event_loop_;
 std::unique_ptr<Paint_buffer> System::paint_buffer_ = nullptr;  // NOLINT
 std::unique_ptr<detail::Abstract_event_listener> System::event_listener_ =
-    std::make_unique<detail::NCurses_event_listener>();  // NOLINT
+    nullptr;  // NOLINT
 
 std::unique_ptr<Palette> System::system_palette_ = nullptr;  // NOLINT
 
 void System::post_event(std::unique_ptr<Event> event) {
-    System::event_loop_.event_queue.append(std::move(event));
+    System::event_loop_.post(std::move(event));
 }
 
 bool System::send_event(const Event& event) {
@@ -47,6 +51,32 @@ void System::exit(int return_code) {
     event_loop_.exit(return_code);
 }
 
+void System::watch_fd(int fd, sig::Slot<void()> on_readable) {
+    event_loop_.watch_fd(fd, std::move(on_readable));
+}
+
+void System::unwatch_fd(int fd) {
+    event_loop_.unwatch_fd(fd);
+}
+
+std::size_t System::start_timer(Event_handler* receiver,
+                                std::chrono::milliseconds interval,
+                                bool repeating) {
+    return event_loop_.start_timer(receiver, interval, repeating);
+}
+
+void System::stop_timer(std::size_t timer_id) {
+    event_loop_.stop_timer(timer_id);
+}
+
+bool System::timer_active(std::size_t timer_id) {
+    return event_loop_.timer_active(timer_id);
+}
+
+void System::set_frame_rate(unsigned frames_per_second) {
+    event_loop_.set_frame_rate(frames_per_second);
+}
+
 detail::Abstract_event_listener* System::event_listener() {
     return event_listener_.get();
 }
@@ -83,14 +113,22 @@ Palette* System::palette() {
     return system_palette_.get();
 }
 
-System::System() {
-    System::set_paint_buffer(std::make_unique<Paint_buffer>());
+System::System()
+    : System{std::make_unique<detail::NCurses_paint_engine>(),
+             std::make_unique<detail::NCurses_event_listener>()} {}
+
+System::System(std::unique_ptr<detail::Paint_engine> engine,
+               std::unique_ptr<detail::Abstract_event_listener> listener) {
+    System::set_paint_buffer(
+        std::make_unique<Paint_buffer>(std::move(engine)));
+    event_listener_ = std::move(listener);
     System::set_palette(std::make_unique<DawnBringer_palette>());
     this->disable_ctrl_characters();
 }
 
 System::~System() {
     System::set_paint_buffer(nullptr);
+    event_listener_ = nullptr;
 }
 
 void System::set_head(Widget* head_widget) {
@@ -0,0 +1,19 @@
+#include <cppurses/system/event_handler.hpp>
+#include <cppurses/system/events/timer_event.hpp>
+
+#include <cstddef>
+
+namespace cppurses {
+
+Timer_event::Timer_event(Event_handler* receiver, std::size_t timer_id)
+    : Event{Event::Timer, receiver}, timer_id_{timer_id} {}
+
+bool Timer_event::send() const {
+    return receiver_->timer_event(timer_id_);
+}
+
+bool Timer_event::filter_send(Event_handler* filter) const {
+    return filter->timer_event_filter(receiver_, timer_id_);
+}
+
+}  // namespace cppurses
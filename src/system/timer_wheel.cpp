@@ -0,0 +1,168 @@
+#include <cppurses/system/detail/timer_wheel.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const std::size_t level0_bits{8};
+const std::size_t level_bits{6};
+const std::uint64_t level_mask{(1 << level_bits) - 1};
+
+std::size_t level_shift(std::size_t level) {
+    return level0_bits + level_bits * level;
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+Timer_wheel::Timer_wheel(Clock::time_point start) : start_{start} {}
+
+Timer_wheel::Id Timer_wheel::add(Event_handler* receiver,
+                                 std::chrono::milliseconds interval,
+                                 bool repeating,
+                                 Clock::time_point now) {
+    const std::uint64_t ms =
+        std::max<std::chrono::milliseconds::rep>(interval.count(), 1);
+    const Id id{next_id_++};
+    timers_.emplace(id, Timer{receiver, ms, repeating});
+    this->insert(Entry{id, std::max(this->to_tick(now), tick_) + ms});
+    return id;
+}
+
+void Timer_wheel::remove(Id id) {
+    timers_.erase(id);
+}
+
+void Timer_wheel::advance(std::vector<Expired>& due, Clock::time_point now) {
+    const std::uint64_t target{this->to_tick(now)};
+    if (timers_.empty()) {
+        tick_ = std::max(tick_, target);
+        return;
+    }
+    while (tick_ < target) {
+        ++tick_;
+        if ((tick_ & 255) == 0) {
+            this->cascade(0);
+        }
+        Slot& slot = level0_[tick_ & 255];
+        if (slot.empty()) {
+            continue;
+        }
+        // Repeating timers are inserted again while the slot is processed.
+        expiring_.clear();
+        std::swap(expiring_, slot);
+        for (const Entry& entry : expiring_) {
+            auto found = timers_.find(entry.id);
+            if (found == std::end(timers_)) {
+                continue;  // Removed
+            }
+            if (entry.expires > tick_) {
+                this->insert(entry);
+                continue;
+            }
+            Timer& timer = found->second;
+            due.push_back(Expired{timer.receiver, entry.id});
+            if (timer.repeating) {
+                // Fire once if late, then stay on the original period.
+                std::uint64_t next{entry.expires + timer.interval};
+                if (next <= target) {
+                    const std::uint64_t missed{(target - entry.expires) /
+                                               timer.interval};
+                    next = entry.expires + (missed + 1) * timer.interval;
+                }
+                this->insert(Entry{entry.id, next});
+            } else {
+                timers_.erase(found);
+            }
+        }
+    }
+}
+
+int Timer_wheel::next_timeout(Clock::time_point now) const {
+    if (timers_.empty()) {
+        return -1;
+    }
+    std::uint64_t next{std::numeric_limits<std::uint64_t>::max()};
+    for (std::uint64_t d{1}; d <= 256; ++d) {
+        if (!level0_[(tick_ + d) & 255].empty()) {
+            next = tick_ + d;
+            break;
+        }
+    }
+    // A timer in an upper level is due no earlier than its slot cascades.
+    for (std::size_t level{0}; level < upper_levels_.size(); ++level) {
+        const std::size_t shift{level_shift(level)};
+        const std::uint64_t base{tick_ >> shift};
+        for (std::uint64_t d{1}; d <= 64; ++d) {
+            if (!upper_levels_[level][(base + d) & level_mask].empty()) {
+                next = std::min(next, (base + d) << shift);
+                break;
+            }
+        }
+    }
+    const std::uint64_t current{this->to_tick(now)};
+    if (next <= current) {
+        return 0;
+    }
+    return static_cast<int>(std::min<std::uint64_t>(
+        next - current, std::numeric_limits<int>::max()));
+}
+
+std::uint64_t Timer_wheel::to_tick(Clock::time_point t) const {
+    if (t <= start_) {
+        return 0;
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(t - start_)
+        .count();
+}
+
+void Timer_wheel::insert(Entry entry, bool cascading) {
+    // Overdue timers go in the next slot to be processed. While cascading
+    // that is the slot of the current tick.
+    const std::uint64_t earliest{cascading ? tick_ : tick_ + 1};
+    const std::uint64_t at{std::max(entry.expires, earliest)};
+    const std::uint64_t delta{at - tick_};
+    if (delta < 256) {
+        level0_[at & 255].push_back(entry);
+        return;
+    }
+    for (std::size_t level{0}; level < upper_levels_.size(); ++level) {
+        const std::size_t shift{level_shift(level)};
+        if (delta < (std::uint64_t{1} << (shift + level_bits))) {
+            upper_levels_[level][(at >> shift) & level_mask].push_back(entry);
+            return;
+        }
+    }
+    // Further out than the wheel reaches, park it in the last slot of the
+    // top level, it is placed again each time that slot cascades.
+    const std::size_t top{upper_levels_.size() - 1};
+    const std::uint64_t index{(tick_ >> level_shift(top)) + level_mask};
+    upper_levels_[top][index & level_mask].push_back(entry);
+}
+
+// Called when the bits below level's shift have wrapped around to zero.
+void Timer_wheel::cascade(std::size_t level) {
+    const std::size_t shift{level_shift(level)};
+    const std::uint64_t index{(tick_ >> shift) & level_mask};
+    if (index == 0 && level + 1 < upper_levels_.size()) {
+        this->cascade(level + 1);
+    }
+    Slot entries;
+    std::swap(entries, upper_levels_[level][index]);
+    for (const Entry& entry : entries) {
+        if (timers_.count(entry.id) != 0) {
+            this->insert(entry, true);
+        }
+    }
+}
+
+}  // namespace detail
+}  // namespace cppurses
@@ -418,7 +418,7 @@ void Horizontal_layout::collect_space(std::vector<Dimensions_reference> widgets,
 
 void Horizontal_layout::position_widgets(
     const std::vector<std::size_t>& widths) {
-    std::vector<Widget*> widgets{this->children()};
+    const auto widgets = this->children();
     if (widgets.size() != widths.size()) {
         return;
     }
@@ -10,6 +10,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
 #include <utility>
 
 namespace cppurses {
@@ -105,6 +106,10 @@ bool Line_edit::key_press_event(Key key, char symbol) {
     return Textbox::key_press_event(key, symbol);
 }
 
+bool Line_edit::paste_event(const std::string& text) {
+    return false;
+}
+
 bool Line_edit::mouse_press_event(Mouse_button button,
                                   Point global,
                                   Point local,
@@ -3,6 +3,7 @@
 
 #include <signals/slot.hpp>
 
+#include <string>
 #include <utility>
 
 namespace cppurses {
@@ -12,7 +13,6 @@ void Log::post_message(Glyph_string message) {
         this->append('\n');
     }
     this->append(std::move(message));
-    this->update_display();
     std::size_t tl = this->top_line();
     std::size_t h = this->height();
     std::size_t nol = this->n_of_lines();
@@ -30,6 +30,11 @@ bool Log::key_press_event(Key key, char symbol) {
     return true;
 }
 
+// Read only, pasted text is ignored like typed text.
+bool Log::paste_event(const std::string& text) {
+    return true;
+}
+
 namespace slot {
 
 sig::Slot<void(Glyph_string)> post_message(Log& log) {
@@ -14,17 +14,21 @@
 namespace cppurses {
 
 void Text_display::update() {
-    this->update_display();
+    // Edits rewrap as they happen, only a new width needs a full rewrap.
+    if (this->width() != wrap_width_) {
+        this->update_display();
+    }
     Widget::update();
 }
 
 Text_display::Text_display(Glyph_string content)
-    : contents_{std::move(content)} {}
+    : contents_{content} {}
 
 void Text_display::set_text(Glyph_string text) {
-    contents_ = std::move(text);
+    contents_ = detail::Glyph_rope{text};
+    this->update_display();
     this->update();
-    text_changed(contents_);
+    text_changed();
 }
 
 void Text_display::insert(Glyph_string text, std::size_t index) {
@@ -37,10 +41,10 @@ void Text_display::insert(Glyph_string text, std::size_t index) {
             glyph.brush().add_attributes(attr);
         }
     }
-    contents_.insert(std::begin(contents_) + index, std::begin(text),
-                     std::end(text));
+    contents_.insert(index, text);
+    this->rewrap(index, 0, text.size());
     this->update();
-    text_changed(contents_);
+    text_changed();
 }
 
 void Text_display::append(Glyph_string text) {
@@ -49,39 +53,43 @@ void Text_display::append(Glyph_string text) {
             glyph.brush().add_attributes(attr);
         }
     }
+    const auto index = contents_.size();
     contents_.append(text);
+    this->rewrap(index, 0, text.size());
     this->update();
-    text_changed(contents_);
+    text_changed();
 }
 
 void Text_display::erase(std::size_t index, std::size_t length) {
     if (contents_.empty() || index >= contents_.size()) {
         return;
     }
-    auto end = std::begin(contents_) + length + index;
-    if (length == Glyph_string::npos) {
-        end = std::end(contents_);
+    if (length > contents_.size() - index) {
+        length = contents_.size() - index;
     }
-    contents_.erase(std::begin(contents_) + index, end);
+    contents_.erase(index, length);
+    this->rewrap(index, length, 0);
     this->update();
-    text_changed(contents_);
+    text_changed();
 }
 
 void Text_display::pop_back() {
     if (contents_.empty()) {
         return;
     }
-    contents_.pop_back();
+    contents_.erase(contents_.size() - 1, 1);
+    this->rewrap(contents_.size(), 1, 0);
     this->update();
-    text_changed(contents_);
+    text_changed();
 }
 
 void Text_display::clear() {
     contents_.clear();
     this->move_cursor_x(0);
     this->move_cursor_y(0);
+    this->update_display();
     this->update();
-    text_changed(contents_);
+    text_changed();
 }
 
 void Text_display::set_alignment(Alignment type) {
@@ -99,7 +107,8 @@ void Text_display::scroll_up(std::size_t n) {
     } else {
         top_line_ -= n;
     }
-    this->update();
+    // Line breaks do not change, only repaint.
+    Widget::update();
     scrolled_up(n);
     scrolled();
 }
@@ -110,23 +119,26 @@ void Text_display::scroll_down(std::size_t n) {
     } else {
         top_line_ += n;
     }
-    this->update();
+    Widget::update();
     scrolled_down(n);
     scrolled();
 }
 
 void Text_display::enable_word_wrap(bool enable) {
     word_wrap_ = enable;
+    this->update_display();
     this->update();
 }
 
 void Text_display::disable_word_wrap(bool disable) {
     word_wrap_ = !disable;
+    this->update_display();
     this->update();
 }
 
 void Text_display::toggle_word_wrap() {
     word_wrap_ = !word_wrap_;
+    this->update_display();
     this->update();
 }
 
@@ -156,8 +168,9 @@ std::size_t Text_display::index_at(std::size_t x, std::size_t y) const {
     if (line >= display_state_.size()) {
         return contents_size();
     }
-    auto info = display_state_.at(line);
-    if (x >= info.length) {
+    const Line_info info{this->line_start(line), this->line_length(line),
+                         display_state_[line].columns};
+    if (x >= info.columns) {
         if (info.length == 0) {
             x = 0;
         } else if (this->top_line() + y != this->last_line()) {
@@ -168,7 +181,18 @@ std::size_t Text_display::index_at(std::size_t x, std::size_t y) const {
             x = info.length - 1;
         }
     }
-    return info.start_index + x;
+    if (info.columns == info.length) {
+        return info.start_index + x;
+    }
+    // Wide glyphs take up two columns, either one maps to the glyph.
+    std::size_t index{info.start_index};
+    std::size_t columns{0};
+    for (auto glyph = contents_.iterator_at(index);; ++glyph, ++index) {
+        columns += glyph.width();
+        if (columns > x) {
+            return index;
+        }
+    }
 }
 
 Point Text_display::display_position(std::size_t index) const {
@@ -185,7 +209,12 @@ Point Text_display::display_position(std::size_t index) const {
         index = this->contents_size();
     }
     position.y = line - this->top_line();
-    position.x = index - this->first_index_at(line);
+    const std::size_t first{this->first_index_at(line)};
+    if (display_state_[line].columns == display_state_[line].length) {
+        position.x = index - first;
+    } else {
+        position.x = this->columns(first, index);
+    }
     return position;
 }
 
@@ -193,82 +222,197 @@ bool Text_display::paint_event() {
     Painter p{this};
     std::size_t line_n{0};
     auto paint = [&p, &line_n, this](const Line_info& line) {
-        auto sub_begin = std::begin(this->contents_) + line.start_index;
-        auto sub_end = sub_begin + line.length;
+        // A single wide glyph can be wider than the Text_display.
+        const std::size_t space{
+            line.columns < this->width() ? this->width() - line.columns : 0};
         std::size_t start{0};
         switch (alignment_) {
             case Alignment::Left:
                 start = 0;
                 break;
             case Alignment::Center:
-                start = (this->width() - line.length) / 2;
+                start = space / 2;
                 break;
 
             case Alignment::Right:
-                start = this->width() - line.length;
+                start = space;
                 break;
         }
-        p.put(Glyph_string(sub_begin, sub_end), start, line_n++);
+        p.put(contents_, line.start_index, line.length, start, line_n++);
     };
-    auto begin = std::begin(display_state_) + this->top_line();
-    auto end = std::end(display_state_);
-    if (display_state_.size() > this->top_line() + this->height()) {
-        end = begin + this->height();
-    }
-    if (this->top_line() < display_state_.size()) {
-        std::for_each(begin, end, paint);
+    const auto end =
+        std::min(display_state_.size(), this->top_line() + this->height());
+    for (std::size_t line{this->top_line()}; line < end; ++line) {
+        const Line_info& info{display_state_[line]};
+        paint(Line_info{this->line_start(line), info.length, info.columns});
     }
     return Widget::paint_event();
 }
 
 // TODO: Implement tab character.
 void Text_display::update_display(std::size_t from_line) {
-    std::size_t begin = display_state_.at(from_line).start_index;
-    display_state_.clear();
     if (this->width() == 0) {
-        display_state_.push_back(Line_info{0, 0});
+        display_state_.assign(1, Line_info{0, 0, 0});
+        shift_from_ = 0;
+        shift_by_ = 0;
+        wrap_width_ = 0;
+        return;
+    }
+    if (from_line > this->last_line() || this->width() != wrap_width_) {
+        from_line = 0;
+    }
+    std::size_t start{this->line_start(from_line)};
+    this->move_shift_to(from_line);
+    display_state_.erase(std::begin(display_state_) + from_line,
+                         std::end(display_state_));
+    shift_by_ = 0;
+    while (start != Glyph_string::npos) {
+        Line_info line;
+        start = this->wrap_line(start, line);
+        display_state_.push_back(line);
+    }
+    wrap_width_ = this->width();
+    // Reset top_line_ if out of bounds of new display.
+    if (this->top_line() >= display_state_.size()) {
+        top_line_ = this->last_line();
+    }
+}
+
+void Text_display::rewrap(std::size_t index,
+                          std::size_t removed,
+                          std::size_t added) {
+    if (this->width() == 0 || this->width() != wrap_width_) {
+        this->update_display();
         return;
     }
-    std::size_t start_index{0};
+    // A line break only depends on the line's start and the glyphs up to
+    // width() past it, so lines before first keep their breaks.
+    std::size_t first{this->line_at(index)};
+    while (first > 0) {
+        const std::size_t start{this->line_start(first)};
+        if (contents_.iterator_at(start - 1).symbol_is('\n') ||
+            this->line_start(first - 1) + this->width() <= index) {
+            break;
+        }
+        --first;
+    }
+    // Past the edit, a line starting where an old line started wraps the
+    // same, and so do all of the lines after it.
+    std::vector<Line_info> lines;
+    std::size_t last{display_state_.size()};
+    std::size_t start{this->line_start(first)};
+    while (true) {
+        Line_info line;
+        start = this->wrap_line(start, line);
+        lines.push_back(line);
+        if (start == Glyph_string::npos) {
+            break;
+        }
+        if (start >= index + added) {
+            const std::size_t old_start{start - added + removed};
+            const std::size_t old_line{this->line_at(old_start)};
+            if (old_line > first && this->line_start(old_line) == old_start) {
+                last = old_line;
+                break;
+            }
+        }
+    }
+    // Lines before last hold their actual start_index after this.
+    this->move_shift_to(last);
+    const auto replaced = last - first;
+    const auto begin = std::begin(display_state_) + first;
+    if (lines.size() > replaced) {
+        std::copy(std::begin(lines), std::begin(lines) + replaced, begin);
+        display_state_.insert(begin + replaced,
+                              std::begin(lines) + replaced, std::end(lines));
+    } else {
+        std::copy(std::begin(lines), std::end(lines), begin);
+        display_state_.erase(begin + lines.size(), begin + replaced);
+    }
+    shift_from_ = first + lines.size();
+    shift_by_ += added - removed;
+    if (this->top_line() >= display_state_.size()) {
+        top_line_ = this->last_line();
+    }
+}
+
+std::size_t Text_display::wrap_line(std::size_t start, Line_info& line) const {
     std::size_t length{0};
+    std::size_t columns{0};
     std::size_t last_space{0};
-    for (std::size_t i{begin}; i < contents_.size(); ++i) {
+    std::size_t last_space_columns{0};
+    auto wrap = [&] {
+        if (word_wrap_ && last_space > 0) {
+            length = last_space;
+            columns = last_space_columns;
+        }
+        line = Line_info{start, length, columns};
+        return start + length;
+    };
+    auto glyph = contents_.iterator_at(start);
+    for (std::size_t i{start}; i < contents_.size(); ++i, ++glyph) {
+        const std::size_t width{glyph.width()};
+        if (length != 0 && columns + width > this->width()) {
+            // A wide glyph that does not fit starts the next line.
+            return wrap();
+        }
         ++length;
-        if (word_wrap_ && contents_.at(i).str() == " ") {
+        columns += width;
+        if (word_wrap_ && glyph.symbol_is(' ')) {
             last_space = length;
+            last_space_columns = columns;
         }
-        if (contents_.at(i).str() == "\n") {
-            display_state_.push_back(Line_info{start_index, length - 1});
-            start_index += length;
-            length = 0;
-        } else if (length == this->width()) {
-            if (this->does_word_wrap() && last_space > 0) {
-                i -= length - last_space;
-                length = last_space;
-                last_space = 0;
-            }
-            display_state_.push_back(Line_info{start_index, length});
-            start_index += length;
-            length = 0;
+        if (glyph.symbol_is('\n')) {
+            line = Line_info{start, length - 1, columns - 1};
+            return start + length;
+        }
+        if (columns >= this->width()) {
+            return wrap();
         }
     }
-    display_state_.push_back(Line_info{start_index, length});
-    // Reset top_line_ if out of bounds of new display.
-    if (this->top_line() >= display_state_.size()) {
-        top_line_ = this->last_line();
+    line = Line_info{start, length, columns};
+    return Glyph_string::npos;
+}
+
+std::size_t Text_display::line_start(std::size_t line) const {
+    const auto start = display_state_[line].start_index;
+    return line < shift_from_ ? start : start + shift_by_;
+}
+
+std::size_t Text_display::columns(std::size_t first, std::size_t last) const {
+    std::size_t columns{0};
+    auto glyph = contents_.iterator_at(first);
+    for (std::size_t i{first}; i < last; ++i, ++glyph) {
+        columns += glyph.width();
+    }
+    return columns;
+}
+
+void Text_display::move_shift_to(std::size_t line) {
+    if (shift_by_ != 0) {
+        for (std::size_t i{line}; i < shift_from_; ++i) {
+            display_state_[i].start_index -= shift_by_;
+        }
+        for (std::size_t i{shift_from_}; i < line; ++i) {
+            display_state_[i].start_index += shift_by_;
+        }
     }
+    shift_from_ = line;
 }
 
+// Last line starting at or before index.
 std::size_t Text_display::line_at(std::size_t index) const {
-    std::size_t line{0};
-    for (const auto& info : display_state_) {
-        if (info.start_index <= index) {
-            ++line;
+    std::size_t low{0};
+    std::size_t high{display_state_.size()};
+    while (high - low > 1) {
+        const std::size_t middle{low + (high - low) / 2};
+        if (this->line_start(middle) <= index) {
+            low = middle;
         } else {
-            return line - 1;
+            high = middle;
         }
     }
-    return this->last_line();
+    return low;
 }
 
 std::size_t Text_display::display_height() const {
@@ -299,7 +443,7 @@ std::size_t Text_display::first_index_at(std::size_t line) const {
     if (line >= display_state_.size()) {
         line = display_state_.size() - 1;
     }
-    return display_state_.at(line).start_index;
+    return this->line_start(line);
 }
 
 std::size_t Text_display::last_index_at(std::size_t line) const {
@@ -307,7 +451,7 @@ std::size_t Text_display::last_index_at(std::size_t line) const {
     if (next_line >= display_state_.size()) {
         return this->end_index();
     }
-    return display_state_.at(next_line).start_index;
+    return this->line_start(next_line);
 }
 
 std::size_t Text_display::line_length(std::size_t line) const {
@@ -5,6 +5,7 @@
 #include <cppurses/widget/widgets/textbox.hpp>
 
 #include <cstddef>
+#include <string>
 #include <utility>
 
 namespace cppurses {
@@ -99,6 +100,19 @@ bool Textbox::key_press_event(Key key, char symbol) {
     return true;
 }
 
+bool Textbox::paste_event(const std::string& text) {
+    auto cursor_index = this->cursor_index();
+    Glyph_string pasted{text};
+    const auto end_index = cursor_index + pasted.size();
+    this->insert(std::move(pasted), cursor_index);
+    const auto line = this->line_at(end_index);
+    if (line >= this->top_line() + this->height()) {
+        this->scroll_down(line + 1 - this->top_line() - this->height());
+    }
+    this->set_cursor(end_index);
+    return true;
+}
+
 bool Textbox::mouse_press_event(Mouse_button button,
                                 Point global,
                                 Point local,
@@ -419,7 +419,7 @@ void Vertical_layout::collect_space(std::vector<Dimensions_reference> widgets,
 
 void Vertical_layout::position_widgets(
     const std::vector<std::size_t>& heights) {
-    std::vector<Widget*> widgets{this->children()};
+    const auto widgets = this->children();
     if (widgets.size() != heights.size()) {
         return;
     }
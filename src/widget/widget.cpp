@@ -5,6 +5,7 @@
 #include <cppurses/system/events/child_event.hpp>
 #include <cppurses/system/events/clear_screen_event.hpp>
 #include <cppurses/system/events/deferred_delete_event.hpp>
+#include <cppurses/system/detail/find_widget_at.hpp>
 #include <cppurses/system/events/on_tree_event.hpp>
 #include <cppurses/system/events/paint_event.hpp>
 #include <cppurses/system/focus.hpp>
@@ -41,6 +42,7 @@ Widget::~Widget() {
     if (Focus::focus_widget() == this) {
         Focus::clear_focus();
     }
+    detail::invalidate_hit_grid();
 }
 
 void Widget::set_name(std::string name) {
@@ -54,6 +56,7 @@ std::string Widget::name() const {
 
 void Widget::set_parent(Widget* parent) {
     parent_ = parent;
+    this->invalidate_global_position();
 }
 
 Widget* Widget::parent() const {
@@ -63,6 +66,7 @@ Widget* Widget::parent() const {
 void Widget::add_child(std::unique_ptr<Widget> child) {
     children_.emplace_back(std::move(child));
     children_.back()->set_parent(this);
+    detail::invalidate_hit_grid();
     System::post_event<Child_added_event>(this, children_.back().get());
     System::post_event<On_tree_event>(children_.back().get(), this->on_tree());
 }
@@ -70,15 +74,13 @@ void Widget::add_child(std::unique_ptr<Widget> child) {
 void Widget::insert_child(std::unique_ptr<Widget> child, std::size_t index) {
     children_.insert(std::begin(children_) + index, std::move(child));
     children_[index]->set_parent(this);
+    detail::invalidate_hit_grid();
     System::post_event<Child_added_event>(this, children_[index].get());
     System::post_event<On_tree_event>(children_[index].get(), this->on_tree());
 }
 
-std::vector<Widget*> Widget::children() const {
-    std::vector<Widget*> ret;
-    std::transform(std::begin(children_), std::end(children_),
-                   std::back_inserter(ret), [](auto& up) { return up.get(); });
-    return ret;
+Children_view Widget::children() const {
+    return Children_view{children_};
 }
 
 bool Widget::contains_child(Widget* child) {
@@ -100,6 +102,7 @@ std::unique_ptr<Widget> Widget::remove_child(Widget* child) {
     std::unique_ptr<Widget> removed = std::move(*at);
     children_.erase(at);
     removed->set_parent(nullptr);
+    detail::invalidate_hit_grid();
     System::send_event(Child_removed_event{this, child});
     System::send_event(On_tree_event{removed.get(), false});
     return removed;
@@ -110,19 +113,37 @@ std::unique_ptr<Widget> Widget::remove_child(const std::string& name) {
 }
 
 std::size_t Widget::x() const {
-    Widget* parent = this->parent();
-    if (parent == nullptr) {
-        return this->position_.x + west_border_offset(*this);
-    }
-    return this->position_.x + parent->x() + west_border_offset(*this);
+    this->update_global_position();
+    return global_position_.x;
 }
 
 std::size_t Widget::y() const {
+    this->update_global_position();
+    return global_position_.y;
+}
+
+void Widget::update_global_position() const {
+    if (global_position_valid_) {
+        return;
+    }
+    global_position_.x = position_.x + west_border_offset(*this);
+    global_position_.y = position_.y + north_border_offset(*this);
     Widget* parent = this->parent();
-    if (parent == nullptr) {
-        return this->position_.y + north_border_offset(*this);
+    if (parent != nullptr) {
+        global_position_.x += parent->x();
+        global_position_.y += parent->y();
+    }
+    global_position_valid_ = true;
+}
+
+void Widget::invalidate_global_position() {
+    if (!global_position_valid_) {
+        return;
+    }
+    global_position_valid_ = false;
+    for (auto& child : children_) {
+        child->invalidate_global_position();
     }
-    return this->position_.y + parent->y() + north_border_offset(*this);
 }
 
 std::size_t Widget::width() const {
@@ -279,8 +300,11 @@ bool Widget::hide_event() {
 }
 
 bool Widget::move_event(Point new_position, Point old_position) {
+    detail::invalidate_hit_area(*this);
     this->set_x(new_position.x);
     this->set_y(new_position.y);
+    this->invalidate_global_position();
+    detail::invalidate_hit_area(*this);
     moved(new_position);
     moved_xy(new_position.x, new_position.y);
     this->update();
@@ -288,6 +312,7 @@ bool Widget::move_event(Point new_position, Point old_position) {
 }
 
 bool Widget::resize_event(Area new_size, Area old_size) {
+    detail::invalidate_hit_area(*this);
     east_border_disqualified_ = false;
     west_border_disqualified_ = false;
     north_border_disqualified_ = false;
@@ -318,10 +343,13 @@ bool Widget::resize_event(Area new_size, Area old_size) {
         south_border_disqualified_ = true;
     }
 
+    // Border offsets might have changed.
+    this->invalidate_global_position();
     width_ =
         new_size.width - east_border_offset(*this) - west_border_offset(*this);
     height_ = new_size.height - north_border_offset(*this) -
               south_border_offset(*this);
+    detail::invalidate_hit_area(*this);
 
     resized(width_, height_);
     this->update();
@@ -330,6 +358,7 @@ bool Widget::resize_event(Area new_size, Area old_size) {
 
 void Widget::set_visible(bool visible, bool recursive) {
     visible_ = visible;
+    detail::invalidate_hit_grid();
     if (!recursive) {
         return;
     }
@@ -384,11 +413,15 @@ bool has_border(const Widget& w) {
 
 void enable_border(Widget& w) {
     w.border.enabled = true;
+    w.invalidate_global_position();
+    detail::invalidate_hit_grid();
     System::post_event<Child_polished_event>(w.parent(), &w);
 }
 
 void disable_border(Widget& w) {
     w.border.enabled = false;
+    w.invalidate_global_position();
+    detail::invalidate_hit_grid();
     System::post_event<Child_polished_event>(w.parent(), &w);
 }
 
@@ -55,3 +55,13 @@ TEST(BrushTest, RemoveAttribute) {
     ASSERT_TRUE(bool(b.foreground_color()));
     EXPECT_EQ(Color::Green, *b.foreground_color());
 }
+
+TEST(BrushTest, HasAttribute) {
+    Brush b(Attribute::Bold, background(Color::Blue), Attribute::Blink);
+    EXPECT_TRUE(b.has_attribute(Attribute::Bold));
+    EXPECT_TRUE(b.has_attribute(Attribute::Blink));
+    EXPECT_FALSE(b.has_attribute(Attribute::Italic));
+    EXPECT_FALSE(b.has_attribute(Attribute::Inverse));
+    b.remove_attribute(Attribute::Bold);
+    EXPECT_FALSE(b.has_attribute(Attribute::Bold));
+}
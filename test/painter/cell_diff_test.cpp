@@ -0,0 +1,49 @@
+#include <painter/detail/cell.hpp>
+#include <painter/detail/cell_diff.hpp>
+#include <painter/glyph.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using cppurses::Glyph;
+using cppurses::detail::Cell;
+using cppurses::detail::find_mismatch;
+using cppurses::detail::find_mismatch_scalar;
+using cppurses::detail::to_cell;
+
+TEST(CellDiffTest, Implementation) {
+    const std::string name{cppurses::detail::find_mismatch_implementation()};
+    EXPECT_TRUE(name == "avx2" || name == "sse2" || name == "scalar");
+}
+
+TEST(CellDiffTest, FindsEveryPosition) {
+    // Lengths around the block sizes, differences in every field of a Cell.
+    const Cell changes[] = {to_cell(Glyph{"b"}),
+                            to_cell(Glyph{"a", cppurses::Attribute::Bold}),
+                            to_cell(Glyph{"a", cppurses::foreground(
+                                                   cppurses::Color::Red)})};
+    for (std::size_t length{0}; length < 100; ++length) {
+        const std::vector<Cell> lhs(length, to_cell(Glyph{"a"}));
+        std::vector<Cell> rhs{lhs};
+        ASSERT_EQ(length, find_mismatch(lhs.data(), rhs.data(), length));
+        for (std::size_t i{0}; i < length; ++i) {
+            for (const Cell& change : changes) {
+                rhs[i] = change;
+                ASSERT_EQ(i, find_mismatch(lhs.data(), rhs.data(), length));
+                ASSERT_EQ(i,
+                          find_mismatch_scalar(lhs.data(), rhs.data(), length));
+                // Only the first difference is found.
+                if (i + 1 < length) {
+                    rhs[length - 1] = change;
+                    ASSERT_EQ(i,
+                              find_mismatch(lhs.data(), rhs.data(), length));
+                    rhs[length - 1] = lhs[length - 1];
+                }
+                rhs[i] = lhs[i];
+            }
+        }
+    }
+}
@@ -0,0 +1,55 @@
+#include <painter/attribute.hpp>
+#include <painter/brush.hpp>
+#include <painter/color.hpp>
+#include <painter/detail/cell.hpp>
+#include <painter/glyph.hpp>
+
+#include <gtest/gtest.h>
+
+using cppurses::Attribute;
+using cppurses::Brush;
+using cppurses::Color;
+using cppurses::Glyph;
+using cppurses::detail::Cell;
+using cppurses::detail::to_cell;
+using cppurses::detail::to_glyph;
+
+TEST(CellTest, RoundTrip) {
+    const Glyph glyphs[] = {
+        Glyph{},
+        Glyph{"a"},
+        Glyph{"ab"},
+        Glyph{"⎔", Attribute::Bold, Attribute::Blink},
+        Glyph{"𝄞", cppurses::background(Color::Black)},
+        Glyph{"x", cppurses::foreground(Color::White)},
+        Glyph{"y", cppurses::background(Color::Violet),
+              cppurses::foreground(Color::Dark_red), Attribute::Underline}};
+    for (const Glyph& g : glyphs) {
+        EXPECT_EQ(g, to_glyph(to_cell(g))) << g;
+    }
+    EXPECT_EQ(8, sizeof(Cell));
+}
+
+TEST(CellTest, Equality) {
+    EXPECT_EQ(to_cell(Glyph{"a", Attribute::Bold}),
+              to_cell(Glyph{"a", Attribute::Bold}));
+    EXPECT_NE(to_cell(Glyph{"a"}), to_cell(Glyph{"b"}));
+    EXPECT_NE(to_cell(Glyph{"a"}), to_cell(Glyph{"a", Attribute::Bold}));
+    // An unset color differs from Black, the zero offset.
+    EXPECT_NE(to_cell(Glyph{"a"}),
+              to_cell(Glyph{"a", cppurses::background(Color::Black)}));
+    EXPECT_TRUE(same_brush(to_cell(Glyph{"a", Attribute::Bold}),
+                           to_cell(Glyph{"b", Attribute::Bold})));
+}
+
+TEST(CellTest, AddDefaultBrush) {
+    Cell defaults;
+    set_brush(defaults, Brush{cppurses::background(Color::Blue),
+                              cppurses::foreground(Color::White),
+                              Attribute::Italic});
+    Cell c{to_cell(Glyph{"a", cppurses::foreground(Color::Red)})};
+    add_default_brush(c, defaults);
+    EXPECT_EQ(Glyph("a", cppurses::background(Color::Blue),
+                    cppurses::foreground(Color::Red), Attribute::Italic),
+              to_glyph(c));
+}
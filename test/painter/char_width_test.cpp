@@ -0,0 +1,55 @@
+#include <painter/detail/char_width.hpp>
+#include <painter/glyph.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using cppurses::Glyph;
+using cppurses::detail::char_width;
+using cppurses::detail::symbol_width;
+
+namespace {
+
+std::size_t width_of(const char* symbol) {
+    return symbol_width(symbol, std::strlen(symbol));
+}
+
+}  // namespace
+
+TEST(CharWidthTest, CodePoints) {
+    EXPECT_EQ(1, char_width(U'a'));
+    EXPECT_EQ(1, char_width(U'\n'));
+    EXPECT_EQ(1, char_width(U'é'));
+    EXPECT_EQ(1, char_width(U'─'));
+    EXPECT_EQ(0, char_width(U'\u0301'));
+    EXPECT_EQ(0, char_width(U'\u200D'));
+    EXPECT_EQ(0, char_width(U'\uFE0F'));
+    EXPECT_EQ(2, char_width(U'ᄀ'));
+    EXPECT_EQ(2, char_width(U'中'));
+    EXPECT_EQ(2, char_width(U'가'));
+    EXPECT_EQ(2, char_width(U'Ａ'));
+    EXPECT_EQ(2, char_width(U'\U0001F600'));
+    EXPECT_EQ(2, char_width(U'\U00020000'));
+    EXPECT_EQ(1, char_width(U'\U0001F1E6'));
+}
+
+TEST(CharWidthTest, Symbols) {
+    EXPECT_EQ(1, width_of(""));
+    EXPECT_EQ(1, width_of("a"));
+    EXPECT_EQ(1, width_of("e\xCC\x81"));
+    EXPECT_EQ(2, width_of("\xE4\xB8\xAD"));
+    // Heart with emoji presentation selector.
+    EXPECT_EQ(2, width_of("\xE2\x9D\xA4\xEF\xB8\x8F"));
+    // Malformed bytes count as one column each.
+    EXPECT_EQ(1, width_of("\xE4\xB8"));
+}
+
+TEST(CharWidthTest, Glyphs) {
+    EXPECT_EQ(1, Glyph{'a'}.width());
+    EXPECT_EQ(1, Glyph{"\xE2\x94\x80"}.width());
+    EXPECT_EQ(2, Glyph{"\xE4\xB8\xAD"}.width());
+    EXPECT_EQ(2, Glyph{"\xF0\x9F\x98\x80"}.width());
+    // Woman, ZWJ, girl, interned.
+    EXPECT_EQ(2, Glyph{"\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7"}.width());
+}
@@ -53,3 +53,57 @@ TEST(GlyphMatrixTest, Default) {
     EXPECT_THROW(gm2.at(4, 3), std::out_of_range);
     EXPECT_THROW(gm2.at(5, 2), std::out_of_range);
 }
+
+TEST(GlyphMatrixTest, ContiguousRows) {
+    Glyph_matrix gm{4, 3};
+    ASSERT_EQ(gm.data(), gm.row(0));
+    EXPECT_EQ(gm.row(0) + 4, gm.row(1));
+    EXPECT_EQ(gm.row(1) + 4, gm.row(2));
+    EXPECT_EQ(&gm(0, 1), gm.row(1));
+    EXPECT_EQ(&gm(3, 2), gm.row(2) + 3);
+
+    gm.row(1)[2] = Glyph{"x"};
+    EXPECT_EQ("x", gm.at(2, 1).str());
+
+    const Glyph_matrix& cgm{gm};
+    EXPECT_EQ("x", cgm.row(1)[2].str());
+}
+
+TEST(GlyphMatrixTest, ResizeKeepsContents) {
+    Glyph_matrix gm{3, 2};
+    gm(0, 0) = Glyph{"a"};
+    gm(2, 0) = Glyph{"b"};
+    gm(1, 1) = Glyph{"c", foreground(Color::Red)};
+
+    // Height only
+    gm.resize(3, 4);
+    EXPECT_EQ(3, gm.width());
+    EXPECT_EQ(4, gm.height());
+    EXPECT_EQ("a", gm.at(0, 0).str());
+    EXPECT_EQ("b", gm.at(2, 0).str());
+    EXPECT_EQ((Glyph{"c", foreground(Color::Red)}), gm.at(1, 1));
+    EXPECT_EQ(" ", gm.at(2, 3).str());
+
+    // Wider
+    gm.resize(5, 4);
+    EXPECT_EQ(5, gm.width());
+    EXPECT_EQ("a", gm.at(0, 0).str());
+    EXPECT_EQ("b", gm.at(2, 0).str());
+    EXPECT_EQ((Glyph{"c", foreground(Color::Red)}), gm.at(1, 1));
+    EXPECT_EQ(" ", gm.at(3, 0).str());
+    EXPECT_EQ(" ", gm.at(4, 1).str());
+    EXPECT_EQ(gm.row(0) + 5, gm.row(1));
+
+    // Narrower and shorter
+    gm.resize(2, 1);
+    EXPECT_EQ(2, gm.width());
+    EXPECT_EQ(1, gm.height());
+    EXPECT_EQ("a", gm.at(0, 0).str());
+    EXPECT_THROW(gm.at(2, 0), std::out_of_range);
+    EXPECT_THROW(gm.at(1, 1), std::out_of_range);
+
+    gm.clear();
+    EXPECT_EQ(0, gm.width());
+    EXPECT_EQ(0, gm.height());
+    EXPECT_THROW(gm.at(0, 0), std::out_of_range);
+}
@@ -0,0 +1,129 @@
+#include <painter/attribute.hpp>
+#include <painter/color.hpp>
+#include <painter/detail/glyph_rope.hpp>
+#include <painter/glyph.hpp>
+#include <painter/glyph_string.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string>
+
+using cppurses::Attribute;
+using cppurses::Color;
+using cppurses::Glyph;
+using cppurses::Glyph_string;
+using cppurses::detail::Glyph_rope;
+
+namespace {
+
+Glyph_string random_glyphs(std::mt19937& gen, std::size_t size) {
+    const std::string symbols[] = {"a", "b", " ", "\n", "é", "⎔", "𝄞", "ab",
+                                   "", "e\xCC\x81", "abcdefgh"};
+    std::uniform_int_distribution<std::size_t> pick{0, 10};
+    Glyph_string glyphs;
+    for (std::size_t i{0}; i < size; ++i) {
+        Glyph g{symbols[pick(gen)]};
+        if (gen() % 3 == 0) {
+            g.brush().add_attributes(Attribute::Bold);
+        }
+        if (gen() % 5 == 0) {
+            g.brush().add_attributes(cppurses::foreground(Color::Red));
+        }
+        glyphs.append(g);
+    }
+    return glyphs;
+}
+
+void expect_equal(const Glyph_string& expected, const Glyph_rope& rope) {
+    ASSERT_EQ(expected.size(), rope.size());
+    std::size_t i{0};
+    for (Glyph g : rope) {
+        ASSERT_EQ(expected[i], g) << "at " << i;
+        ++i;
+    }
+    ASSERT_EQ(expected.size(), i);
+    // AVL trees are at most about 1.44 * log2(n) high.
+    const double nodes = static_cast<double>(rope.node_count());
+    EXPECT_LE(rope.height(), 1.5 * std::log2(nodes + 2) + 1);
+}
+
+}  // namespace
+
+TEST(GlyphRopeTest, Empty) {
+    Glyph_rope rope;
+    EXPECT_TRUE(rope.empty());
+    EXPECT_EQ(0, rope.size());
+    EXPECT_EQ(rope.begin(), rope.end());
+    EXPECT_THROW(rope.at(0), std::out_of_range);
+    rope.erase(0, 5);
+    EXPECT_TRUE(rope.str().empty());
+}
+
+TEST(GlyphRopeTest, KeepsSymbolsAndBrushes) {
+    const Glyph_string glyphs({Glyph{"⎔", Attribute::Bold},
+                               Glyph{"A", cppurses::background(Color::Blue)},
+                               Glyph{"𝄞"}, Glyph{"ab", Attribute::Italic},
+                               Glyph{""}, Glyph{"abcdefgh"}, Glyph{'\xFF'}});
+    const Glyph_rope rope{glyphs};
+    expect_equal(glyphs, rope);
+    EXPECT_EQ(glyphs[3], rope.at(3));
+    EXPECT_TRUE(rope.iterator_at(1).symbol_is('A'));
+    EXPECT_FALSE(rope.iterator_at(0).symbol_is('A'));
+}
+
+TEST(GlyphRopeTest, RandomEditsMatchGlyphString) {
+    std::mt19937 gen{11};
+    Glyph_string expected{random_glyphs(gen, 3000)};
+    Glyph_rope rope{expected};
+    expect_equal(expected, rope);
+    for (int edit{0}; edit < 400; ++edit) {
+        std::uniform_int_distribution<std::size_t> at{0, expected.size()};
+        const std::size_t index{at(gen)};
+        if (gen() % 2 == 0) {
+            // Mostly small inserts, some spanning several leaves.
+            const std::size_t size{gen() % 10 == 0 ? gen() % 2000
+                                                   : 1 + gen() % 8};
+            const Glyph_string glyphs{random_glyphs(gen, size)};
+            expected.insert(std::begin(expected) + index, std::begin(glyphs),
+                            std::end(glyphs));
+            rope.insert(index, glyphs);
+        } else {
+            std::size_t length{gen() % 10 == 0 ? gen() % 2000 : 1 + gen() % 8};
+            length = std::min(length, expected.size() - index);
+            expected.erase(std::begin(expected) + index,
+                           std::begin(expected) + index + length);
+            rope.erase(index, length);
+        }
+        expect_equal(expected, rope);
+        if (HasFatalFailure()) {
+            FAIL() << "after edit " << edit;
+        }
+    }
+    const std::size_t middle{expected.size() / 2};
+    EXPECT_EQ(Glyph_string(std::begin(expected) + middle,
+                           std::begin(expected) + middle + 10),
+              rope.substr(middle, 10));
+}
+
+TEST(GlyphRopeTest, CopiesAreSnapshots) {
+    Glyph_rope rope{Glyph_string{"hello world"}};
+    const Glyph_rope snapshot{rope};
+    rope.insert(5, ",");
+    rope.erase(0, 1);
+    EXPECT_EQ("ello, world", rope.str().str());
+    EXPECT_EQ("hello world", snapshot.str().str());
+}
+
+TEST(GlyphRopeTest, TypingKeepsLeavesFull) {
+    Glyph_rope rope;
+    const std::size_t size{100 * Glyph_rope::max_leaf_size};
+    for (std::size_t i{0}; i < size; ++i) {
+        rope.insert(rope.size() / 2, "x");
+    }
+    EXPECT_EQ(size, rope.size());
+    // Split leaves are at least half full.
+    EXPECT_LE(rope.node_count(), 2 * (2 * size / Glyph_rope::max_leaf_size));
+}
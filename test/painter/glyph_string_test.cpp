@@ -168,3 +168,47 @@ TEST(GlyphStringTest, OperatorPlus) {
                                       gs2[6], gs2[7]}}));
     EXPECT_EQ(gs[6], (cppurses::Glyph("b", cppurses::Attribute::Italic)));
 }
+
+TEST(GlyphStringTest, ZeroWidthCodePoints) {
+    // e, combining acute accent, then a combining grave and a circumflex.
+    cppurses::Glyph_string gs{"e\xCC\x81x\xCC\x80\xCC\x82"};
+    ASSERT_EQ(2, gs.size());
+    EXPECT_EQ("e\xCC\x81", gs[0].str());
+    EXPECT_EQ("x\xCC\x80\xCC\x82", gs[1].str());
+
+    // Woman, zero width joiner, laptop.
+    cppurses::Glyph_string emoji{
+        "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB!"};
+    ASSERT_EQ(2, emoji.size());
+    EXPECT_EQ(2, emoji[0].width());
+    EXPECT_EQ("!", emoji[1].str());
+
+    // Nothing to add a leading mark to, and newlines are kept on their own.
+    cppurses::Glyph_string lone{"\xCC\x81" "a\n\xCC\x81"};
+    ASSERT_EQ(4, lone.size());
+    EXPECT_EQ("\n", lone[2].str());
+    EXPECT_EQ("\xCC\x81", lone[3].str());
+}
+
+TEST(GlyphStringTest, MalformedUtf8) {
+    // Stray continuation byte, overlong '/', surrogate, truncated sequence.
+    cppurses::Glyph_string gs{"a\x80" "b\xC0\xAF" "c\xED\xA0\x80" "d\xE4\xB8"};
+    EXPECT_EQ("a\xEF\xBF\xBD" "b\xEF\xBF\xBD\xEF\xBF\xBD"
+              "c\xEF\xBF\xBD\xEF\xBF\xBD\xEF\xBF\xBD" "d\xEF\xBF\xBD",
+              gs.str());
+    EXPECT_EQ(11, gs.size());
+}
+
+TEST(GlyphStringTest, LongAsciiText) {
+    std::string text;
+    for (int i{0}; i < 100; ++i) {
+        text.push_back(static_cast<char>('!' + i % 90));
+    }
+    text.append("\xCC\x81\xE4\xB8\xAD");
+    cppurses::Glyph_string gs{text, cppurses::Attribute::Bold};
+    ASSERT_EQ(101, gs.size());
+    EXPECT_EQ(text, gs.str());
+    EXPECT_EQ(std::string(1, text[99]) + "\xCC\x81", gs[99].str());
+    EXPECT_EQ(cppurses::Glyph("\xE4\xB8\xAD", cppurses::Attribute::Bold),
+              gs[100]);
+}
@@ -0,0 +1,69 @@
+#include <painter/attribute.hpp>
+#include <painter/detail/cell.hpp>
+#include <painter/detail/grapheme_table.hpp>
+#include <painter/glyph.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+using cppurses::Attribute;
+using cppurses::Glyph;
+using cppurses::detail::grapheme_table;
+using cppurses::detail::to_cell;
+using cppurses::detail::to_glyph;
+
+namespace {
+
+// e followed by a combining acute accent.
+const std::string combining{"e\xCC\x81"};
+// Woman, ZWJ, woman, ZWJ, girl.
+const std::string family{
+    "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7"};
+
+}  // namespace
+
+TEST(GraphemeTableTest, InternsOnce) {
+    const std::uint32_t first{grapheme_table().intern("abcdef", 6)};
+    const std::size_t size{grapheme_table().size()};
+    EXPECT_EQ(first, grapheme_table().intern("abcdef", 6));
+    EXPECT_EQ(size, grapheme_table().size());
+    EXPECT_NE(first, grapheme_table().intern("abcdeg", 6));
+    EXPECT_EQ("abcdef", grapheme_table().symbol(first));
+    EXPECT_EQ(1, grapheme_table().width(first));
+}
+
+TEST(GraphemeTableTest, LongGlyphSymbols) {
+    const Glyph long_symbol{family, Attribute::Bold};
+    EXPECT_EQ(family, long_symbol.str());
+    EXPECT_EQ(combining, Glyph{combining}.str());
+    EXPECT_EQ("abcde", Glyph{"abcde"}.str());
+
+    EXPECT_EQ(long_symbol, Glyph(family, Attribute::Bold));
+    EXPECT_NE(long_symbol, Glyph(family));
+    EXPECT_NE(Glyph{"abcde"}, Glyph{"abcdf"});
+    EXPECT_NE(Glyph{"abcde"}, Glyph{"abcd"});
+
+    Glyph g{"abcde"};
+    g.set_symbol('x');
+    EXPECT_EQ(Glyph{"x"}, g);
+    EXPECT_EQ("x", g.str());
+}
+
+TEST(GraphemeTableTest, MarkerByteSymbol) {
+    // 0xFF marks an interned symbol, so a symbol starting with it is interned.
+    const Glyph g{'\xFF'};
+    EXPECT_EQ("\xFF", g.str());
+    EXPECT_EQ(g, Glyph{"\xFF"});
+    EXPECT_NE(g, Glyph{""});
+}
+
+TEST(GraphemeTableTest, CellRoundTrip) {
+    const Glyph glyphs[] = {Glyph{family, Attribute::Underline},
+                            Glyph{combining}, Glyph{'\xFF'}};
+    for (const Glyph& g : glyphs) {
+        EXPECT_EQ(g, to_glyph(to_cell(g))) << g;
+    }
+    EXPECT_NE(to_cell(Glyph{family}), to_cell(Glyph{combining}));
+}
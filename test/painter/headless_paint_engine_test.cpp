@@ -0,0 +1,42 @@
+#include <painter/detail/headless_paint_engine.hpp>
+#include <painter/glyph.hpp>
+#include <painter/glyph_string.hpp>
+
+#include <gtest/gtest.h>
+
+using cppurses::Glyph;
+using cppurses::Glyph_string;
+using cppurses::detail::Headless_paint_engine;
+
+TEST(HeadlessPaintEngineTest, Dimensions) {
+    Headless_paint_engine engine{10, 4};
+    EXPECT_EQ(10, engine.screen_width());
+    EXPECT_EQ(4, engine.screen_height());
+    EXPECT_EQ(10, engine.screen().width());
+    EXPECT_EQ(4, engine.screen().height());
+
+    engine.resize(20, 2);
+    EXPECT_EQ(20, engine.screen_width());
+    EXPECT_EQ(2, engine.screen_height());
+    EXPECT_EQ(20, engine.screen().width());
+    EXPECT_EQ(2, engine.screen().height());
+}
+
+TEST(HeadlessPaintEngineTest, PutRun) {
+    Headless_paint_engine engine{5, 2};
+    Glyph_string text{"hello world"};
+    engine.put_run(2, 1, &text[0], text.size());
+    engine.put(0, 0, Glyph{"x"});
+    engine.refresh();
+
+    EXPECT_EQ(Glyph{"x"}, engine.screen().at(0, 0));
+    EXPECT_EQ(Glyph{" "}, engine.screen().at(1, 1));
+    EXPECT_EQ(Glyph{"h"}, engine.screen().at(2, 1));
+    EXPECT_EQ(Glyph{"l"}, engine.screen().at(4, 1));
+    EXPECT_EQ(12, engine.glyphs_written());
+    EXPECT_EQ(1, engine.refresh_count());
+
+    engine.reset_counters();
+    EXPECT_EQ(0, engine.glyphs_written());
+    EXPECT_EQ(0, engine.refresh_count());
+}
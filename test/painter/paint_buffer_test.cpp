@@ -0,0 +1,61 @@
+#include <painter/detail/headless_paint_engine.hpp>
+#include <painter/glyph.hpp>
+#include <painter/paint_buffer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <utility>
+
+using cppurses::Glyph;
+using cppurses::Paint_buffer;
+using cppurses::detail::Headless_paint_engine;
+
+namespace {
+
+// CJK ideograph, two columns wide.
+const char* const wide{"\xE4\xB8\xAD"};
+
+}  // namespace
+
+TEST(PaintBufferTest, WideGlyphs) {
+    auto engine = std::make_unique<Headless_paint_engine>(6, 1);
+    const Headless_paint_engine& screen{*engine};
+    Paint_buffer buffer{std::move(engine)};
+    buffer.stage(0, 0, Glyph{wide});
+    buffer.stage(2, 0, Glyph{"a"});
+    buffer.stage(5, 0, Glyph{wide});
+    buffer.flush(true);
+    EXPECT_EQ(Glyph{wide}, screen.screen().at(0, 0));
+    EXPECT_EQ(Glyph{""}, screen.screen().at(1, 0));
+    EXPECT_EQ(Glyph{"a"}, screen.screen().at(2, 0));
+    // Only half would fit at the last column.
+    EXPECT_EQ(Glyph{" "}, screen.screen().at(5, 0));
+    EXPECT_EQ(Glyph{wide}, buffer.at(0, 0));
+    EXPECT_EQ(Glyph{""}, buffer.at(1, 0));
+}
+
+TEST(PaintBufferTest, PaintingOverHalfAWideGlyph) {
+    auto engine = std::make_unique<Headless_paint_engine>(6, 1);
+    const Headless_paint_engine& screen{*engine};
+    Paint_buffer buffer{std::move(engine)};
+    buffer.stage(0, 0, Glyph{wide});
+    buffer.stage(3, 0, Glyph{wide});
+    buffer.flush(true);
+
+    // Right half of the first, left half of the second.
+    buffer.stage(1, 0, Glyph{"x"});
+    buffer.stage(3, 0, Glyph{"y"});
+    buffer.flush(true);
+    EXPECT_EQ(Glyph{" "}, screen.screen().at(0, 0));
+    EXPECT_EQ(Glyph{"x"}, screen.screen().at(1, 0));
+    EXPECT_EQ(Glyph{"y"}, screen.screen().at(3, 0));
+    EXPECT_EQ(Glyph{" "}, screen.screen().at(4, 0));
+    EXPECT_EQ(Glyph{" "}, buffer.at(0, 0));
+    EXPECT_EQ(Glyph{" "}, buffer.at(4, 0));
+
+    // Nothing is left to send.
+    const auto written = screen.glyphs_written();
+    buffer.flush(true);
+    EXPECT_EQ(written, screen.glyphs_written());
+}
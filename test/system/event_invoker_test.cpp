@@ -0,0 +1,124 @@
+#include <system/detail/event_invoker.hpp>
+#include <system/detail/event_queue.hpp>
+#include <system/event.hpp>
+#include <system/events/key_event.hpp>
+#include <system/events/paint_event.hpp>
+#include <system/events/resize_event.hpp>
+#include <system/key.hpp>
+#include <widget/area.hpp>
+#include <widget/widget.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using cppurses::Area;
+using cppurses::Event;
+using cppurses::Key;
+using cppurses::Key_press_event;
+using cppurses::Paint_event;
+using cppurses::Resize_event;
+using cppurses::Widget;
+using cppurses::detail::Event_invoker;
+using cppurses::detail::Event_queue;
+
+namespace {
+
+// Posts a Paint_event to itself on every Resize_event.
+class Counter : public Widget {
+   public:
+    explicit Counter(Event_queue& queue) : queue_{queue} {}
+    int paints{0};
+    int resizes{0};
+    int key_presses{0};
+
+   protected:
+    bool paint_event() override {
+        ++paints;
+        return true;
+    }
+    bool resize_event(Area new_size, Area old_size) override {
+        ++resizes;
+        queue_.append(std::make_unique<Paint_event>(this));
+        return true;
+    }
+    bool key_press_event(Key key, char symbol) override {
+        ++key_presses;
+        return true;
+    }
+
+   private:
+    Event_queue& queue_;
+};
+
+}  // namespace
+
+TEST(EventInvokerTest, PostedDuringDelivery) {
+    Event_queue queue;
+    Counter w{queue};
+    Event_invoker invoker;
+
+    // The Paint_event is sent before the Resize_event posts another.
+    queue.append(std::make_unique<Paint_event>(&w));
+    queue.append(std::make_unique<Resize_event>(&w, Area{1, 1}));
+    invoker.invoke(queue);
+    EXPECT_EQ(1, w.resizes);
+    EXPECT_EQ(2, w.paints);
+    EXPECT_TRUE(queue.empty());
+
+    // The pending Paint_event is replaced by the one the Resize_event posts.
+    w.paints = 0;
+    queue.append(std::make_unique<Resize_event>(&w, Area{2, 2}));
+    queue.append(std::make_unique<Paint_event>(&w));
+    invoker.invoke(queue);
+    EXPECT_EQ(2, w.resizes);
+    EXPECT_EQ(1, w.paints);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(EventInvokerTest, Filters) {
+    Event_queue queue;
+    Counter w1{queue};
+    Counter w2{queue};
+    Event_invoker invoker;
+
+    queue.append(std::make_unique<Key_press_event>(&w1, Key::a));
+    queue.append(std::make_unique<Paint_event>(&w1));
+    queue.append(std::make_unique<Key_press_event>(&w2, Key::a));
+    queue.append(std::make_unique<Key_press_event>(&w1, Key::b));
+
+    invoker.invoke(queue, Event::KeyPress, &w1);
+    EXPECT_EQ(2, w1.key_presses);
+    EXPECT_EQ(0, w1.paints);
+    EXPECT_EQ(0, w2.key_presses);
+    EXPECT_EQ(2, queue.size());
+
+    invoker.invoke(queue, Event::Paint);
+    EXPECT_EQ(1, w1.paints);
+    EXPECT_EQ(1, queue.size());
+
+    invoker.invoke(queue);
+    EXPECT_EQ(1, w2.key_presses);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(EventInvokerTest, InvokeExcept) {
+    Event_queue queue;
+    Counter w{queue};
+    Event_invoker invoker;
+
+    queue.append(std::make_unique<Paint_event>(&w));
+    queue.append(std::make_unique<Key_press_event>(&w, Key::a));
+    queue.append(std::make_unique<Resize_event>(&w, Area{1, 1}));
+
+    // The Resize_event replaces the held back Paint_event with its own.
+    invoker.invoke_except(queue, Event::Paint);
+    EXPECT_EQ(1, w.key_presses);
+    EXPECT_EQ(1, w.resizes);
+    EXPECT_EQ(0, w.paints);
+    EXPECT_EQ(1, queue.size());
+
+    invoker.invoke(queue);
+    EXPECT_EQ(1, w.paints);
+    EXPECT_TRUE(queue.empty());
+}
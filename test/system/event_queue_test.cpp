@@ -0,0 +1,56 @@
+#include <system/detail/event_queue.hpp>
+#include <system/events/deferred_delete_event.hpp>
+#include <system/events/key_event.hpp>
+#include <system/events/paint_event.hpp>
+#include <system/key.hpp>
+#include <widget/widget.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using cppurses::Deferred_delete_event;
+using cppurses::Key;
+using cppurses::Key_press_event;
+using cppurses::Paint_event;
+using cppurses::Widget;
+using cppurses::detail::Event_queue;
+
+TEST(EventQueueTest, CoalescesPerReceiverAndType) {
+    Widget w1;
+    Widget w2;
+    Event_queue queue;
+    for (int i{0}; i < 100; ++i) {
+        queue.append(std::make_unique<Paint_event>(&w1));
+        queue.append(std::make_unique<Paint_event>(&w2));
+    }
+    EXPECT_EQ(2, queue.size());
+
+    queue.append(std::make_unique<Key_press_event>(&w1, Key::a));
+    queue.append(std::make_unique<Key_press_event>(&w1, Key::a));
+    EXPECT_EQ(4, queue.size());
+
+    queue.append(nullptr);
+    queue.append(std::make_unique<Paint_event>(nullptr));
+    EXPECT_EQ(4, queue.size());
+}
+
+TEST(EventQueueTest, DeferredDeleteReplacesChildren) {
+    Widget head;
+    Widget& parent = head.make_child<Widget>();
+    Widget& child1 = parent.make_child<Widget>();
+    Widget& child2 = parent.make_child<Widget>();
+    Widget& grandchild = child1.make_child<Widget>();
+
+    Event_queue queue;
+    queue.append(std::make_unique<Deferred_delete_event>(&grandchild));
+    queue.append(std::make_unique<Deferred_delete_event>(&child1));
+    queue.append(std::make_unique<Deferred_delete_event>(&child2));
+    EXPECT_EQ(2, queue.size());
+
+    queue.append(std::make_unique<Deferred_delete_event>(&child2));
+    EXPECT_EQ(2, queue.size());
+
+    queue.append(std::make_unique<Deferred_delete_event>(&parent));
+    EXPECT_EQ(1, queue.size());
+}
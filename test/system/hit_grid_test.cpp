@@ -0,0 +1,101 @@
+#include <painter/detail/headless_paint_engine.hpp>
+#include <system/detail/find_widget_at.hpp>
+#include <system/detail/headless_event_listener.hpp>
+#include <system/system.hpp>
+#include <widget/layouts/horizontal_layout.hpp>
+#include <widget/layouts/vertical_layout.hpp>
+#include <widget/widget.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+
+using cppurses::Horizontal_layout;
+using cppurses::System;
+using cppurses::Vertical_layout;
+using cppurses::Widget;
+using cppurses::detail::Headless_event_listener;
+using cppurses::detail::Headless_paint_engine;
+using cppurses::detail::find_widget_at;
+
+namespace {
+
+const std::size_t screen_width{30};
+const std::size_t screen_height{10};
+
+// The tree walk the Hit_grid replaces.
+Widget* walk_tree(std::size_t x, std::size_t y) {
+    Widget* widg = System::head();
+    if (widg == nullptr || !has_coordinates(*widg, x, y)) {
+        return nullptr;
+    }
+    bool keep_going = true;
+    while (keep_going && !widg->children().empty()) {
+        for (Widget* child : widg->children()) {
+            if (has_coordinates(*child, x, y) && child->enabled()) {
+                widg = child;
+                keep_going = true;
+                break;
+            }
+            keep_going = false;
+        }
+    }
+    return widg;
+}
+
+void expect_same_as_tree_walk() {
+    for (std::size_t y{0}; y < screen_height + 1; ++y) {
+        for (std::size_t x{0}; x < screen_width + 1; ++x) {
+            ASSERT_EQ(walk_tree(x, y), find_widget_at(x, y))
+                << "at (" << x << ", " << y << ")";
+        }
+    }
+}
+
+}  // namespace
+
+TEST(HitGridTest, MatchesTreeWalk) {
+    System sys{
+        std::make_unique<Headless_paint_engine>(screen_width, screen_height),
+        std::make_unique<Headless_event_listener>()};
+    Vertical_layout head;
+    auto& row = head.make_child<Horizontal_layout>();
+    auto& left = row.make_child<Widget>();
+    auto& middle = row.make_child<Widget>();
+    auto& right = row.make_child<Widget>();
+    auto& bottom = head.make_child<Widget>();
+    enable_border(bottom);
+    sys.set_head(&head);
+    sys.run();
+
+    EXPECT_EQ(&left, find_widget_at(0, 0));
+    EXPECT_EQ(&right, find_widget_at(screen_width - 1, 0));
+    EXPECT_EQ(&head, find_widget_at(0, screen_height - 1));
+    EXPECT_EQ(nullptr, find_widget_at(screen_width, 0));
+    expect_same_as_tree_walk();
+
+    middle.set_enabled(false);
+    expect_same_as_tree_walk();
+    EXPECT_EQ(&row, find_widget_at(screen_width / 2, 0));
+
+    middle.set_enabled(true);
+    right.set_visible(false);
+    expect_same_as_tree_walk();
+    right.set_visible(true);
+
+    // Layout moves and resizes the remaining children.
+    auto removed = row.remove_child(&left);
+    sys.run();
+    expect_same_as_tree_walk();
+    EXPECT_EQ(&middle, find_widget_at(0, 0));
+
+    disable_border(bottom);
+    sys.run();
+    expect_same_as_tree_walk();
+
+    removed.reset();
+    sys.set_head(nullptr);
+    sys.run();
+    EXPECT_EQ(nullptr, find_widget_at(0, 0));
+}
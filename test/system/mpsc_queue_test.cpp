@@ -0,0 +1,72 @@
+#include <system/detail/mpsc_queue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using cppurses::detail::Mpsc_queue;
+
+TEST(MpscQueueTest, SingleThreadFifo) {
+    Mpsc_queue<std::unique_ptr<int>> queue;
+    EXPECT_TRUE(queue.empty());
+    for (int i{0}; i < 5; ++i) {
+        queue.push(std::make_unique<int>(i));
+    }
+    EXPECT_FALSE(queue.empty());
+    std::unique_ptr<int> value;
+    for (int i{0}; i < 5; ++i) {
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(i, *value);
+    }
+    EXPECT_FALSE(queue.pop(value));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpscQueueTest, DestructorFreesValues) {
+    auto shared = std::make_shared<int>(7);
+    {
+        Mpsc_queue<std::shared_ptr<int>> queue;
+        queue.push(shared);
+        queue.push(shared);
+        EXPECT_EQ(3, shared.use_count());
+    }
+    EXPECT_EQ(1, shared.use_count());
+}
+
+TEST(MpscQueueTest, ManyProducers) {
+    const std::size_t producer_count{4};
+    const std::size_t per_producer{20000};
+    Mpsc_queue<std::size_t> queue;
+
+    std::vector<std::thread> producers;
+    for (std::size_t p{0}; p < producer_count; ++p) {
+        producers.emplace_back([&queue, p, per_producer] {
+            for (std::size_t i{0}; i < per_producer; ++i) {
+                queue.push(p * per_producer + i);
+            }
+        });
+    }
+
+    // Values from each producer must arrive in the order they were pushed.
+    std::vector<std::size_t> next(producer_count, 0);
+    std::size_t received{0};
+    std::size_t value{0};
+    while (received < producer_count * per_producer) {
+        if (!queue.pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const std::size_t producer{value / per_producer};
+        ASSERT_LT(producer, producer_count);
+        EXPECT_EQ(next[producer], value % per_producer);
+        next[producer] = value % per_producer + 1;
+        ++received;
+    }
+    for (std::thread& t : producers) {
+        t.join();
+    }
+    EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,79 @@
+#include <painter/detail/headless_paint_engine.hpp>
+#include <system/detail/headless_event_listener.hpp>
+#include <system/focus.hpp>
+#include <system/key.hpp>
+#include <system/system.hpp>
+#include <widget/layouts/vertical_layout.hpp>
+#include <widget/widgets/line_edit.hpp>
+#include <widget/widgets/textbox.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+using cppurses::Focus;
+using cppurses::Key;
+using cppurses::Line_edit;
+using cppurses::System;
+using cppurses::Textbox;
+using cppurses::Vertical_layout;
+using cppurses::detail::Headless_event_listener;
+using cppurses::detail::Headless_paint_engine;
+
+namespace {
+
+// Runs a headless System with the given Widget focused until the script
+// in listener is used up.
+void run_script(Vertical_layout& head,
+                cppurses::Widget& focus,
+                std::unique_ptr<Headless_event_listener> listener) {
+    System sys{std::make_unique<Headless_paint_engine>(20, 5),
+               std::move(listener)};
+    Focus::set_focus_to(&focus);
+    sys.set_head(&head);
+    sys.run();
+    // The script is used up, this only sends what is left in the queue so
+    // nothing refers to the Widgets once the test returns.
+    sys.set_head(nullptr);
+    Focus::set_focus_to(nullptr);
+    sys.run();
+}
+
+}  // namespace
+
+TEST(PasteEventTest, TextboxInsertsAtCursor) {
+    Vertical_layout head;
+    auto& textbox = head.make_child<Textbox>();
+    int changes{0};
+    textbox.text_changed.connect([&changes] { ++changes; });
+
+    auto listener = std::make_unique<Headless_event_listener>();
+    listener->push_keys("ab");
+    listener->push_key(Key::Arrow_left);
+    listener->push_paste("one\ntwo\nthree\nfour\nfive\nsix");
+    run_script(head, textbox, std::move(listener));
+
+    EXPECT_EQ("aone\ntwo\nthree\nfour\nfive\nsixb", textbox.contents().str());
+    EXPECT_EQ(3, changes);
+    // The cursor follows the pasted text, scrolled into view.
+    EXPECT_EQ(28, textbox.cursor_index());
+    EXPECT_EQ(4, textbox.cursor_y());
+}
+
+TEST(PasteEventTest, LineEditTakesKeyPresses) {
+    Vertical_layout head;
+    auto& edit = head.make_child<Line_edit>();
+    edit.set_validator([](char c) { return c != 'x'; });
+    std::string finished;
+    edit.editing_finished.connect(
+        [&finished](std::string text) { finished = std::move(text); });
+
+    auto listener = std::make_unique<Headless_event_listener>();
+    listener->push_paste("axbc\nd");
+    run_script(head, edit, std::move(listener));
+
+    EXPECT_EQ("abc", finished);
+    EXPECT_EQ("abcd", edit.contents().str());
+}
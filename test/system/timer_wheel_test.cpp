@@ -0,0 +1,78 @@
+#include <system/detail/timer_wheel.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+using cppurses::detail::Timer_wheel;
+using std::chrono::milliseconds;
+
+namespace {
+const Timer_wheel::Clock::time_point start{};
+}  // namespace
+
+TEST(TimerWheelTest, SingleShot) {
+    Timer_wheel wheel{start};
+    std::vector<Timer_wheel::Expired> due;
+    EXPECT_EQ(-1, wheel.next_timeout(start));
+
+    auto id = wheel.add(nullptr, milliseconds{10}, false, start);
+    EXPECT_TRUE(wheel.contains(id));
+    EXPECT_EQ(10, wheel.next_timeout(start));
+
+    wheel.advance(due, start + milliseconds{9});
+    EXPECT_TRUE(due.empty());
+    wheel.advance(due, start + milliseconds{10});
+    ASSERT_EQ(1, due.size());
+    EXPECT_EQ(id, due.front().id);
+    EXPECT_FALSE(wheel.contains(id));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, Repeating) {
+    Timer_wheel wheel{start};
+    std::vector<Timer_wheel::Expired> due;
+    auto id = wheel.add(nullptr, milliseconds{100}, true, start);
+    for (int i{1}; i <= 50; ++i) {
+        wheel.advance(due, start + milliseconds{100 * i});
+        EXPECT_EQ(i, due.size());
+    }
+    // Late by several intervals, fires once and keeps its period.
+    due.clear();
+    wheel.advance(due, start + milliseconds{5450});
+    EXPECT_EQ(1, due.size());
+    EXPECT_TRUE(wheel.contains(id));
+}
+
+TEST(TimerWheelTest, Remove) {
+    Timer_wheel wheel{start};
+    std::vector<Timer_wheel::Expired> due;
+    auto id1 = wheel.add(nullptr, milliseconds{5}, true, start);
+    auto id2 = wheel.add(nullptr, milliseconds{5}, true, start);
+    wheel.remove(id1);
+    wheel.advance(due, start + milliseconds{5});
+    ASSERT_EQ(1, due.size());
+    EXPECT_EQ(id2, due.front().id);
+}
+
+TEST(TimerWheelTest, UpperLevels) {
+    Timer_wheel wheel{start};
+    std::vector<Timer_wheel::Expired> due;
+    const std::size_t intervals[] = {255, 256, 300, 16383, 16384, 70000,
+                                     1048576, 5000000, 80000000};
+    for (std::size_t ms : intervals) {
+        wheel.add(nullptr, milliseconds{ms}, false, start);
+    }
+    std::size_t fired{0};
+    for (std::size_t ms : intervals) {
+        EXPECT_LE(wheel.next_timeout(start + milliseconds{fired}),
+                  static_cast<int>(ms - fired));
+        wheel.advance(due, start + milliseconds{ms - 1});
+        EXPECT_EQ(fired, due.size());
+        wheel.advance(due, start + milliseconds{ms});
+        EXPECT_EQ(++fired, due.size());
+    }
+    EXPECT_TRUE(wheel.empty());
+}
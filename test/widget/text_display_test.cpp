@@ -0,0 +1,190 @@
+#include <painter/brush.hpp>
+#include <painter/color.hpp>
+#include <painter/detail/headless_paint_engine.hpp>
+#include <painter/glyph.hpp>
+#include <painter/glyph_string.hpp>
+#include <system/detail/headless_event_listener.hpp>
+#include <system/events/resize_event.hpp>
+#include <system/system.hpp>
+#include <widget/area.hpp>
+#include <widget/widgets/text_display.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <string>
+
+using cppurses::Area;
+using cppurses::Brush;
+using cppurses::Color;
+using cppurses::Glyph;
+using cppurses::Glyph_string;
+using cppurses::Resize_event;
+using cppurses::System;
+using cppurses::Text_display;
+using cppurses::detail::Headless_event_listener;
+using cppurses::detail::Headless_paint_engine;
+
+namespace {
+
+struct Test_display : Text_display {
+    using Text_display::display_position;
+    using Text_display::first_index_at;
+    using Text_display::index_at;
+    using Text_display::line_at;
+    using Text_display::line_length;
+    using Text_display::n_of_lines;
+};
+
+// Expects the same line breaks as wrapping the contents from scratch.
+void expect_fresh_wrap(const Test_display& display, Test_display& fresh) {
+    fresh.enable_word_wrap(display.does_word_wrap());
+    fresh.set_text(display.contents());
+    ASSERT_EQ(fresh.n_of_lines(), display.n_of_lines());
+    for (std::size_t line{0}; line < fresh.n_of_lines(); ++line) {
+        ASSERT_EQ(fresh.first_index_at(line), display.first_index_at(line))
+            << "line " << line;
+        ASSERT_EQ(fresh.line_length(line), display.line_length(line))
+            << "line " << line;
+    }
+    for (std::size_t i{0}; i < fresh.contents_size() + 1; ++i) {
+        ASSERT_EQ(fresh.line_at(i), display.line_at(i)) << "index " << i;
+    }
+}
+
+std::string random_text(std::mt19937& gen, std::size_t size) {
+    const std::string symbols[] = {"a", "a", "a", "a", "a", "b", "b", "b",
+                                   "c", "d", " ", " ", " ", " ", " ", " ",
+                                   "\n", "\xE4\xB8\xAD"};
+    std::uniform_int_distribution<std::size_t> pick{0, 17};
+    std::string text;
+    for (std::size_t i{0}; i < size; ++i) {
+        text.append(symbols[pick(gen)]);
+    }
+    return text;
+}
+
+}  // namespace
+
+TEST(TextDisplayTest, IncrementalWrapMatchesFullWrap) {
+    System sys{std::make_unique<Headless_paint_engine>(30, 10),
+               std::make_unique<Headless_event_listener>()};
+    std::mt19937 gen{7};
+    Test_display fresh;
+    System::send_event(Resize_event{&fresh, Area{8, 5}});
+    for (bool wrap : {true, false}) {
+        Test_display display;
+        System::send_event(Resize_event{&display, Area{8, 5}});
+        display.enable_word_wrap(wrap);
+        display.set_text(random_text(gen, 200));
+        for (int edit{0}; edit < 300; ++edit) {
+            const std::size_t size{display.contents_size()};
+            std::uniform_int_distribution<std::size_t> at{0, size};
+            switch (gen() % 4) {
+                case 0:
+                    display.insert(random_text(gen, 1 + gen() % 12), at(gen));
+                    break;
+                case 1:
+                    display.erase(at(gen), 1 + gen() % 12);
+                    break;
+                case 2:
+                    display.append(random_text(gen, 1 + gen() % 3));
+                    break;
+                case 3:
+                    display.pop_back();
+                    break;
+            }
+            expect_fresh_wrap(display, fresh);
+            if (HasFatalFailure()) {
+                ADD_FAILURE() << "after edit " << edit;
+                break;
+            }
+        }
+        sys.run();
+    }
+    sys.run();
+}
+
+TEST(TextDisplayTest, LineAt) {
+    System sys{std::make_unique<Headless_paint_engine>(30, 10),
+               std::make_unique<Headless_event_listener>()};
+    Test_display display;
+    System::send_event(Resize_event{&display, Area{4, 5}});
+    display.set_text("ab\n\nabcdefg");
+    // Lines: "ab", "", "abcd", "efg".
+    ASSERT_EQ(4, display.n_of_lines());
+    EXPECT_EQ(0, display.line_at(0));
+    EXPECT_EQ(0, display.line_at(2));
+    EXPECT_EQ(1, display.line_at(3));
+    EXPECT_EQ(2, display.line_at(4));
+    EXPECT_EQ(3, display.line_at(8));
+    EXPECT_EQ(3, display.line_at(100));
+    sys.run();
+}
+
+TEST(TextDisplayTest, PaintsVisibleLines) {
+    auto engine = std::make_unique<Headless_paint_engine>(10, 4);
+    const Headless_paint_engine& screen{*engine};
+    System sys{std::move(engine), std::make_unique<Headless_event_listener>()};
+    Test_display display;
+    display.brush = Brush{background(Color::Blue)};
+    sys.set_head(&display);
+    System::send_event(Resize_event{&display, Area{5, 3}});
+    display.set_text(Glyph_string{"ab\ncdefgh\n"} +
+                     Glyph_string{"ij", foreground(Color::Red)});
+    sys.run();
+    // Lines: "ab", "cdefg", "h", "ij".
+    EXPECT_EQ(Glyph("a", background(Color::Blue)), screen.screen().at(0, 0));
+    EXPECT_EQ(Glyph("g", background(Color::Blue)), screen.screen().at(4, 1));
+    EXPECT_EQ(Glyph("h", background(Color::Blue)), screen.screen().at(0, 2));
+    EXPECT_EQ(Glyph{" "}, screen.screen().at(5, 1));
+
+    display.scroll_down(2);
+    sys.run();
+    EXPECT_EQ(Glyph("h", background(Color::Blue)), screen.screen().at(0, 0));
+    EXPECT_EQ(Glyph("i", background(Color::Blue), foreground(Color::Red)),
+              screen.screen().at(0, 1));
+
+    sys.set_head(nullptr);
+    sys.run();
+}
+
+TEST(TextDisplayTest, WideGlyphs) {
+    auto engine = std::make_unique<Headless_paint_engine>(10, 4);
+    const Headless_paint_engine& screen{*engine};
+    System sys{std::move(engine), std::make_unique<Headless_event_listener>()};
+    Test_display display;
+    sys.set_head(&display);
+    System::send_event(Resize_event{&display, Area{5, 3}});
+    display.disable_word_wrap();
+    // CJK ideographs, two columns each.
+    const std::string one{"\xE4\xB8\x80"};
+    const std::string two{"\xE4\xBA\x8C"};
+    const std::string three{"\xE4\xB8\x89"};
+    display.set_text("ab" + one + two + three);
+    sys.run();
+    // Lines: "ab" one, two three.
+    ASSERT_EQ(2, display.n_of_lines());
+    EXPECT_EQ(3, display.line_length(0));
+    EXPECT_EQ(2, display.line_length(1));
+    EXPECT_EQ(one, screen.screen().at(2, 0).str());
+    EXPECT_EQ("", screen.screen().at(3, 0).str());
+    EXPECT_EQ(two, screen.screen().at(0, 1).str());
+    EXPECT_EQ(three, screen.screen().at(2, 1).str());
+
+    EXPECT_EQ(2, display.index_at(2, 0));
+    EXPECT_EQ(2, display.index_at(3, 0));
+    EXPECT_EQ(4, display.index_at(3, 1));
+    EXPECT_EQ(2, display.display_position(4).x);
+    EXPECT_EQ(1, display.display_position(4).y);
+
+    display.set_alignment(cppurses::Alignment::Right);
+    sys.run();
+    EXPECT_EQ(two, screen.screen().at(1, 1).str());
+    EXPECT_EQ(three, screen.screen().at(3, 1).str());
+
+    sys.set_head(nullptr);
+    sys.run();
+}
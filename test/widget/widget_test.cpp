@@ -1,5 +1,91 @@
+#include <painter/detail/headless_paint_engine.hpp>
+#include <system/detail/headless_event_listener.hpp>
+#include <system/focus.hpp>
+#include <system/system.hpp>
+#include <widget/layouts/horizontal_layout.hpp>
+#include <widget/layouts/vertical_layout.hpp>
 #include <widget/widget.hpp>
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+using cppurses::Focus;
+using cppurses::Horizontal_layout;
+using cppurses::System;
+using cppurses::Vertical_layout;
+using cppurses::Widget;
+using cppurses::detail::Headless_event_listener;
+using cppurses::detail::Headless_paint_engine;
+
 TEST(WidgetTest, Default) {}
+
+TEST(WidgetTest, ChildrenView) {
+    System sys{std::make_unique<Headless_paint_engine>(30, 10),
+               std::make_unique<Headless_event_listener>()};
+    Widget parent;
+    EXPECT_TRUE(parent.children().empty());
+    auto& first = parent.make_child<Widget>();
+    auto& second = parent.make_child<Widget>();
+    auto& third = parent.make_child<Widget>();
+
+    const auto children = parent.children();
+    ASSERT_EQ(3, children.size());
+    EXPECT_EQ(&first, children[0]);
+    EXPECT_EQ(&first, children.front());
+    EXPECT_EQ(&third, children.back());
+    EXPECT_EQ(3, std::distance(std::begin(children), std::end(children)));
+
+    const std::vector<Widget*> forward{&first, &second, &third};
+    EXPECT_EQ(forward, children.to_vector());
+    const std::vector<Widget*> reverse(children.rbegin(), children.rend());
+    EXPECT_EQ((std::vector<Widget*>{&third, &second, &first}), reverse);
+
+    auto removed = parent.remove_child(&second);
+    EXPECT_EQ((std::vector<Widget*>{&first, &third}),
+              parent.children().to_vector());
+    sys.run();
+}
+
+TEST(WidgetTest, GlobalPositionFollowsAncestors) {
+    System sys{std::make_unique<Headless_paint_engine>(30, 10),
+               std::make_unique<Headless_event_listener>()};
+    Vertical_layout head;
+    auto& row = head.make_child<Horizontal_layout>();
+    auto& left = row.make_child<Widget>();
+    auto& inner = row.make_child<Vertical_layout>();
+    auto& leaf = inner.make_child<Widget>();
+    sys.set_head(&head);
+    sys.run();
+    EXPECT_EQ(15, leaf.x());
+    EXPECT_EQ(0, leaf.y());
+
+    enable_border(inner);
+    sys.run();
+    EXPECT_EQ(16, leaf.x());
+    EXPECT_EQ(1, leaf.y());
+
+    // Moving an ancestor moves the cached position of its descendants.
+    auto removed = row.remove_child(&left);
+    sys.run();
+    EXPECT_EQ(1, leaf.x());
+    EXPECT_EQ(1, leaf.y());
+
+    enable_border(head);
+    sys.run();
+    EXPECT_EQ(2, leaf.x());
+    EXPECT_EQ(2, leaf.y());
+
+    disable_border(inner);
+    sys.run();
+    EXPECT_EQ(1, leaf.x());
+    EXPECT_EQ(1, leaf.y());
+
+    removed.reset();
+    sys.set_head(nullptr);
+    Focus::set_focus_to(nullptr);
+    sys.run();
+}